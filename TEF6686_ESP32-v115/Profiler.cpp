@@ -0,0 +1,127 @@
+#include "Profiler.h"
+
+typedef struct
+{ uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t sum;
+  uint32_t histogram[PROFILER_BUCKETS];
+} PROFILER_PROBE_DATA;
+
+static PROFILER_PROBE_DATA probes[PROF_COUNT];
+static PROFILER_MARK marks[PROFILER_MARKS];
+static uint8_t markcount;
+static uint8_t marksdropped;
+
+static const char* const probeNames[PROF_COUNT] = {
+  "loop",
+  "getStatus",
+  "doSquelch",
+  "readRds",
+  "ShowModLevel",
+  "showPI",
+  "showPTY",
+  "showPS",
+  "showRadioText",
+  "ShowStereoStatus",
+  "ShowOffset",
+  "ShowSignalLevel",
+  "ShowBW",
+  "XDRGTKRoutine",
+  "XDRcommand",
+  "XDRstatus",
+  "Diagnostics"
+};
+
+// Half-octave buckets: 0-1, 2, 3, 4-5, 6-7, 8-11, 12-15, ... us
+static uint8_t Profiler_Bucket(uint32_t us)
+{
+  if (us < 2) {
+    return 0;
+  }
+  uint8_t n = 31 - __builtin_clz(us);
+  uint8_t bucket = 2 * n - 1 + ((us >> (n - 1)) & 1);
+  return (bucket < PROFILER_BUCKETS) ? bucket : PROFILER_BUCKETS - 1;
+}
+
+static uint32_t Profiler_BucketFloor(uint8_t bucket)
+{
+  if (bucket == 0) {
+    return 0;
+  }
+  return (uint32_t)(2 + ((bucket + 1) & 1)) << ((bucket + 1) / 2 - 1);
+}
+
+void Profiler_Add(PROFILER_PROBE probe, uint32_t us)
+{
+  PROFILER_PROBE_DATA *p = &probes[probe];
+
+  if (p->count == 0 || us < p->min) {
+    p->min = us;
+  }
+  if (us > p->max) {
+    p->max = us;
+  }
+  p->count++;
+  p->sum += us;
+  p->histogram[Profiler_Bucket(us)]++;
+}
+
+void Profiler_Get(PROFILER_PROBE probe, PROFILER_RESULT *result)
+{
+  PROFILER_PROBE_DATA *p = &probes[probe];
+
+  result->count = p->count;
+  result->min = p->min;
+  result->max = p->max;
+  result->avg = (p->count > 0) ? p->sum / p->count : 0;
+  result->p99 = 0;
+
+  uint32_t threshold = p->count - p->count / 100;
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < PROFILER_BUCKETS && p->count > 0; i++) {
+    seen += p->histogram[i];
+    if (seen >= threshold) {
+      uint32_t top = (i + 1 < PROFILER_BUCKETS) ? Profiler_BucketFloor(i + 1) - 1 : p->max;
+      result->p99 = (top < p->max) ? top : p->max;
+      break;
+    }
+  }
+}
+
+const char *Profiler_Name(PROFILER_PROBE probe)
+{
+  return probeNames[probe];
+}
+
+void Profiler_Reset(void)
+{
+  memset(probes, 0, sizeof(probes));
+}
+
+// Records the end of a boot phase, the timeline is kept until the next reboot
+void Profiler_Mark(const char *name)
+{
+  if (markcount < PROFILER_MARKS) {
+    marks[markcount].name = name;
+    marks[markcount].time = micros();
+    markcount++;
+  } else if (marksdropped < 255) {
+    marksdropped++;
+  }
+}
+
+bool Profiler_GetMark(uint8_t index, PROFILER_MARK *mark)
+{
+  if (index >= markcount) {
+    return false;
+  }
+  *mark = marks[index];
+  return true;
+}
+
+// Marks that did not fit, the timeline is cut short when not 0
+uint8_t Profiler_MarksDropped(void)
+{
+  return marksdropped;
+}
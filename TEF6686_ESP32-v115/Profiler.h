@@ -0,0 +1,68 @@
+#ifndef Profiler_h
+#define Profiler_h
+
+#include "Arduino.h"
+
+#define PROFILER_BUCKETS 40
+// setup() marks 7 phases, a cold radio.init() up to 10 with a fast and a
+// slow patch upload, and a boot with chip detection and a wrong saved chip
+// runs init() four times
+#define PROFILER_MARKS   48
+
+typedef enum
+{ PROF_LOOP,
+  PROF_GETSTATUS,
+  PROF_DOSQUELCH,
+  PROF_READRDS,
+  PROF_SHOWMODLEVEL,
+  PROF_SHOWPI,
+  PROF_SHOWPTY,
+  PROF_SHOWPS,
+  PROF_SHOWRADIOTEXT,
+  PROF_SHOWSTEREOSTATUS,
+  PROF_SHOWOFFSET,
+  PROF_SHOWSIGNALLEVEL,
+  PROF_SHOWBW,
+  PROF_XDRGTKROUTINE,
+  PROF_XDRCOMMAND,
+  PROF_XDRSTATUS,
+  PROF_DIAGNOSTICS,
+  PROF_COUNT
+} PROFILER_PROBE;
+
+typedef struct
+{ uint32_t count;
+  uint32_t min;
+  uint32_t avg;
+  uint32_t max;
+  uint32_t p99;
+} PROFILER_RESULT;
+
+typedef struct
+{ const char *name;
+  uint32_t time;
+} PROFILER_MARK;
+
+void Profiler_Add(PROFILER_PROBE probe, uint32_t us);
+void Profiler_Get(PROFILER_PROBE probe, PROFILER_RESULT *result);
+const char *Profiler_Name(PROFILER_PROBE probe);
+void Profiler_Reset(void);
+void Profiler_Mark(const char *name);
+bool Profiler_GetMark(uint8_t index, PROFILER_MARK *mark);
+uint8_t Profiler_MarksDropped(void);
+
+// Times the enclosing scope and books it on a probe. micros() rather than the
+// cycle counter, which wraps after 17.9 s at 240 MHz and scans take longer.
+class ProfileTimer {
+  public:
+    ProfileTimer(PROFILER_PROBE probe) : probe(probe), start(micros()) {}
+    ~ProfileTimer() {
+      Profiler_Add(probe, micros() - start);
+    }
+
+  private:
+    PROFILER_PROBE probe;
+    uint32_t start;
+};
+
+#endif
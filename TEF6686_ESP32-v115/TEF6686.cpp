@@ -1,4 +1,5 @@
 #include "TEF6686.h"
+#include "Profiler.h"
 
 const char* const ptyLUT[] = {
   "None",
@@ -54,27 +55,71 @@ const char* const ptyLUT[] = {
   "Documentary"
 };
 
+// Survives ESP.restart(), not a power cycle: records which patch the
+// tuner was brought up with, so a restart can leave a running tuner alone.
+#define TEF6686_PATCH_MAGIC 0x54454600UL
+RTC_NOINIT_ATTR static uint32_t tunerpatch;
+
+// Returns the Tuner_Patch() result, 1 when the whole patch was written
+static uint16_t TEF6686_Start(byte TEF, bool fast) {
+  uint16_t r = Tuner_Patch(TEF, fast);
+  delay(50);
+  if (digitalRead(15) == LOW) {
+    Tuner_Init9216();
+  } else {
+    Tuner_Init4000();
+  }
+  Profiler_Mark("clock init");
+  return r;
+}
+
 uint8_t TEF6686::init(byte TEF) {
   uint8_t bootstatus;
+  devTEF_Shadow_Invalidate();
   Tuner_I2C_Init();
+  Tuner_SetClock(TUNER_CLOCK_FAST);
+  Profiler_Mark("I2C init");
   getBootStatus(bootstatus);
+  Profiler_Mark("boot status");
+  if (bootstatus != 0 && (tunerpatch & 0xFFFFFF00UL) == TEF6686_PATCH_MAGIC && tunerpatch != (TEF6686_PATCH_MAGIC | TEF)) {
+    // Running another patch of ours (chip detection), reset and reload
+    bootstatus = 0;
+  }
+  if (bootstatus != 0 && tunerpatch == (TEF6686_PATCH_MAGIC | TEF)) {
+    // Warm start: patched, clocked and initialised by our previous boot
+    devTEF_Get_Cmd_SelfTest();
+    Tuner_SetClock(TUNER_CLOCK_QUIET);
+    Profiler_Mark("warm start");
+    return 1;
+  }
+  // Only valid again once the initialisation below has completed, so a reset
+  // halfway through never leads to a warm start on a half set up tuner
+  tunerpatch = 0;
   if (bootstatus == 0) {
-    Tuner_Patch(TEF);
-    delay(50);
-    if (digitalRead(15) == LOW) {
-      Tuner_Init9216();
-    } else {
-      Tuner_Init4000();
+    uint16_t patched = TEF6686_Start(TEF, true);
+    getBootStatus(bootstatus);
+    if (patched != 1 || bootstatus == 0) {
+      // The fast upload failed or was not accepted, repeat it and the rest
+      // of the initialisation the slow way
+      Tuner_SetClock(TUNER_CLOCK_QUIET);
+      TEF6686_Start(TEF, false);
     }
-    power(1);
-    Tuner_Init();
+    Profiler_Mark("patch verify");
   }
+  power(1);
+  Tuner_Init();
+  Profiler_Mark("init table");
+  tunerpatch = TEF6686_PATCH_MAGIC | TEF;
+  devTEF_Get_Cmd_SelfTest();
+  Tuner_SetClock(TUNER_CLOCK_QUIET);
+  return 0;
 }
 
 void TEF6686::power(uint8_t mode) {
+  devTEF_Shadow_Invalidate();
   devTEF_APPL_Set_OperationMode(mode);
   if (mode == 0) {
-    devTEF_Set_Cmd(TEF_FM, Cmd_Tune_To, 7, 1, 10000);
+    devTEF_Set_Cmd<TEF_FM_TUNE_TO>(1, 10000);
   }
 }
 
@@ -113,7 +158,7 @@ void TEF6686::setFMABandw() {
 }
 
 void TEF6686::setAMBandw(uint16_t bandwidth) {
-  devTEF_Radio_Set_Bandwidth_AM(0, bandwidth * 10, 1000, 1000);
+  devTEF_Radio_Set_Bandwidth_AM(0, bandwidth * 10);
 }
 
 void TEF6686::setiMS(uint16_t mph) {
@@ -125,7 +170,11 @@ void TEF6686::setEQ(uint16_t eq) {
 }
 
 bool TEF6686::getStereoStatus() {
-  return Radio_CheckStereo();
+  if (!snapshotFresh(snapshot.stereoStatus)) {
+    snapshot.stereo = Radio_CheckStereo();
+    snapshotStore(snapshot.stereoStatus);
+  }
+  return snapshot.stereo;
 }
 
 void TEF6686::setMono(uint8_t mono) {
@@ -221,29 +270,124 @@ bool TEF6686::getBootStatus(uint8_t &bootstatus) {
 }
 
 
+bool TEF6686::snapshotFresh(TunerSnapshotField &field) {
+  if (field.valid && Tuner_WriteGeneration() == field.generation && millis() - field.time < field.maxAge) {
+    snapshot.hits++;
+    return true;
+  }
+  snapshot.reads++;
+  return false;
+}
+
+void TEF6686::snapshotStore(TunerSnapshotField &field) {
+  field.time = millis();
+  field.generation = Tuner_WriteGeneration();
+  field.valid = true;
+}
+
+// A failed read leaves the previous values in place and returns false
+bool TEF6686::getQuality(bool am) {
+  if (snapshot.am != am || !snapshotFresh(snapshot.quality)) {
+    int16_t level, offset;
+    uint16_t status, USN, WAM, bandwidth, modulation;
+    bool result;
+    if (am) {
+      result = devTEF_Radio_Get_Quality_Status_AM(&status, &level, &USN, &WAM, &offset, &bandwidth, &modulation);
+    } else {
+      result = devTEF_Radio_Get_Quality_Status(&status, &level, &USN, &WAM, &offset, &bandwidth, &modulation);
+    }
+    if (!result) {
+      snapshot.quality.valid = false;
+      return false;
+    }
+    snapshot.status = status;
+    snapshot.level = level;
+    snapshot.USN = USN;
+    snapshot.WAM = WAM;
+    snapshot.offset = offset;
+    snapshot.bandwidth = bandwidth;
+    snapshot.modulation = modulation;
+    snapshot.am = am;
+    snapshotStore(snapshot.quality);
+  }
+  return true;
+}
+
+uint16_t TEF6686::getQualityTime() {
+  return snapshot.status & 0x3FF;
+}
+
+// Polls the quality status until the tuner reports at least ready (0.1 ms
+// since the last tune, TEF6686_QUALITY_READY once all detectors are done).
+// Sleeps for the time still missing between polls. The values are left in
+// the snapshot for the next getStatus(). False on timeout (ms) or read error.
+bool TEF6686::waitForValidQuality(bool am, uint16_t ready, uint16_t timeout) {
+  uint32_t start = millis();
+  uint16_t time;
+
+  for (;;) {
+    snapshot.quality.valid = false;
+    if (!getQuality(am)) {
+      return false;
+    }
+    time = getQualityTime();
+    if (time >= ready) {
+      return true;
+    }
+    if (millis() - start >= timeout) {
+      return false;
+    }
+    if (time < TEF6686_QUALITY_TIME_MAX) {
+      uint32_t wait = ((ready < TEF6686_QUALITY_TIME_MAX ? ready : TEF6686_QUALITY_TIME_MAX) - time) * 100UL;
+      delay(wait / 1000);
+      delayMicroseconds(wait % 1000);
+    } else {
+      delay(1);
+    }
+  }
+}
+
 bool TEF6686::getStatus(int16_t &level, uint16_t &USN, uint16_t &WAM, int16_t &offset, uint16_t &bandwidth, uint16_t &modulation) {
-  uint8_t result = devTEF_Radio_Get_Quality_Status(&level, &USN, &WAM, &offset, &bandwidth, &modulation);
-  return level;
-  return USN;
-  return WAM;
-  return bandwidth;
-  return modulation;
+  bool result = getQuality(false);
+  level = snapshot.level;
+  USN = snapshot.USN;
+  WAM = snapshot.WAM;
+  offset = snapshot.offset;
+  bandwidth = snapshot.bandwidth;
+  modulation = snapshot.modulation;
+  return result;
 }
 
 bool TEF6686::getStatus_AM(int16_t &level, uint16_t &USN, uint16_t &WAM, int16_t &offset, uint16_t &bandwidth, uint16_t &modulation) {
-  uint8_t result = devTEF_Radio_Get_Quality_Status_AM(&level, &USN, &WAM, &offset, &bandwidth, &modulation);
-  return level;
-  return USN;
-  return WAM;
-  return bandwidth;
-  return modulation;
+  bool result = getQuality(true);
+  level = snapshot.level;
+  USN = snapshot.USN;
+  WAM = snapshot.WAM;
+  offset = snapshot.offset;
+  bandwidth = snapshot.bandwidth;
+  modulation = snapshot.modulation;
+  return result;
+}
+
+// Starts the next RDS read on the I2C engine, readRDS() picks up the result
+void TEF6686::requestRDS() {
+  if (!rdsRequested) {
+    devTEF_Radio_Get_RDS_Data_Submit(&rdsRequest);
+    rdsRequested = true;
+  }
 }
 
 bool TEF6686::readRDS(uint16_t &rdsB, uint16_t &rdsC, uint16_t &rdsD, uint16_t &rdsErr) {
   uint8_t rdsBHigh, rdsBLow, rdsCHigh, rdsCLow, rdsDHigh, rdsDLow, isPsReady, rdsAHigh, rdsALow;
 
   uint16_t rdsStat, rdsA;
-  uint16_t result = devTEF_Radio_Get_RDS_Data(&rdsStat, &rdsA, &rdsB, &rdsC, &rdsD, &rdsErr);
+  uint16_t result;
+  if (rdsRequested) {
+    rdsRequested = false;
+    result = devTEF_Radio_Get_RDS_Data_Collect(&rdsRequest, &rdsStat, &rdsA, &rdsB, &rdsC, &rdsD, &rdsErr);
+  } else {
+    result = devTEF_Radio_Get_RDS_Data(&rdsStat, &rdsA, &rdsB, &rdsC, &rdsD, &rdsErr);
+  }
 
   bool dataAvailable = bitRead(rdsStat, 15);
   bool dataLoss = bitRead(rdsStat, 14);
@@ -259,6 +403,11 @@ bool TEF6686::readRDS(uint16_t &rdsB, uint16_t &rdsC, uint16_t &rdsD, uint16_t &
   uint8_t errC = (rdsErr & 0b0000110000000000) >> 10;
   uint8_t errD = (rdsErr & 0b0000001100000000) >> 8;
 
+  stats.groups++;
+  if (errA == 3 || errB == 3 || errC == 3 || errD == 3) {
+    stats.errorGroups++;
+  }
+
   rdsAHigh = (uint8_t)(rdsA >> 8);
   rdsALow = (uint8_t)rdsA;
   rdsBHigh = (uint8_t)(rdsB >> 8);
@@ -317,6 +466,9 @@ bool TEF6686::readRDS(uint16_t &rdsB, uint16_t &rdsC, uint16_t &rdsD, uint16_t &
         strncpy(rdsProgramService, unsafePs[psAB], 8);
         rdsProgramService[8] = '\0';
         rdsFormatString(rdsProgramService, 8);
+        if (stats.psTime == 0) {
+          stats.psTime = millis() - rdsClearTime;
+        }
         psCharIsSet = 0;
         psErrors = 0xFFFFFFFF;
       }
@@ -374,8 +526,18 @@ bool TEF6686::readRDS(uint16_t &rdsB, uint16_t &rdsC, uint16_t &rdsD, uint16_t &
       }
       rdsRadioText[64] = '\0';
       isRdsNewRadioText = 1;
+      rtSegments = 0;
+      rtCrSegment = 0xFF;
     } else {
       isRdsNewRadioText = 0;
+      bitSet(rtSegments, addressRT);
+      if (cr) {
+        rtCrSegment = addressRT;
+      }
+      uint16_t received = (rtCrSegment != 0xFF) ? (2 << rtCrSegment) - 1 : (groupVersion == 0 ? 0xFFFF : 0x00FF);
+      if (stats.rtTime == 0 && (rtSegments & received) == received) {
+        stats.rtTime = millis() - rdsClearTime;
+      }
     }
     rdsAb = ab;
     rdsFormatString(rdsRadioText, 64);
@@ -395,13 +557,42 @@ void TEF6686::getRDS(RdsInfo *rdsInfo) {
 }
 
 
+void TEF6686::getRDSStats(RdsStats *rdsStats) {
+  *rdsStats = stats;
+}
+
+void TEF6686::resetRDSStats() {
+  stats.groups = 0;
+  stats.errorGroups = 0;
+}
+
+void TEF6686::getSnapshotStats(uint32_t *hits, uint32_t *reads) {
+  *hits = snapshot.hits;
+  *reads = snapshot.reads;
+}
+
+void TEF6686::resetSnapshotStats() {
+  snapshot.hits = 0;
+  snapshot.reads = 0;
+}
+
 void TEF6686::clearRDS() {
+  // A group read before the retune belongs to the previous station
+  if (rdsRequested) {
+    rdsRequested = false;
+    devTEF_Get_Cmd_Collect(&rdsRequest);
+  }
   strcpy(rdsProgramType, "");
   strcpy(rdsProgramId, "    ");
   strcpy(rdsProgramService, "        ");
   strcpy(rdsRadioText, "                                         ");
   psErrors = 0xFFFFFFFF;
   psCharIsSet = 0;
+  rtSegments = 0;
+  rtCrSegment = 0xFF;
+  rdsClearTime = millis();
+  stats.psTime = 0;
+  stats.rtTime = 0;
 }
 
 void TEF6686::rdsFormatString(char* str, uint16_t length) {
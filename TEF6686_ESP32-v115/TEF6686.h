@@ -2,8 +2,8 @@
 
 #include "Arduino.h"
 #include "Tuner_Api.h"
-#include "Tuner_Drv_Lithio.h"
 #include "Tuner_Interface.h"
+#include "Tuner_Drv_Lithio.h"
 
 
 struct RdsInfo {
@@ -15,6 +15,45 @@ struct RdsInfo {
   bool newRadioText;
 };
 
+struct RdsStats {
+  uint32_t groups;
+  uint32_t errorGroups;
+  uint32_t psTime;
+  uint32_t rtTime;
+};
+
+#define TEF6686_QUALITY_MAXAGE 20
+#define TEF6686_STEREO_MAXAGE  100
+
+// Quality status time since tune, 0.1 ms: counts to 320, then reads 1000
+#define TEF6686_QUALITY_TIME_MAX 320
+#define TEF6686_QUALITY_READY    1000
+
+// When a snapshot field was read. It is served again until maxAge ms have
+// passed or a command has been written to the tuner since (Tuner_WriteGeneration).
+struct TunerSnapshotField {
+  uint32_t time;
+  uint32_t generation;
+  uint16_t maxAge;
+  bool valid;
+};
+
+struct TunerSnapshot {
+  uint16_t status;
+  int16_t level;
+  uint16_t USN;
+  uint16_t WAM;
+  int16_t offset;
+  uint16_t bandwidth;
+  uint16_t modulation;
+  bool am;
+  TunerSnapshotField quality;
+  bool stereo;
+  TunerSnapshotField stereoStatus;
+  uint32_t hits;
+  uint32_t reads;
+};
+
 class TEF6686 {
   public:
     uint16_t getFrequency();
@@ -29,10 +68,17 @@ class TEF6686 {
     bool getBootStatus(uint8_t &bootstatus);
     void setMono(uint8_t mono);
     bool getStereoStatus();
+    uint16_t getQualityTime();
+    bool waitForValidQuality(bool am, uint16_t ready, uint16_t timeout);
     uint8_t init(byte TEF);
+    void requestRDS();
     bool readRDS(uint16_t  &rdsB, uint16_t  &rdsC, uint16_t  &rdsD, uint16_t  &rdsErr);
     void clearRDS();
     void getRDS(RdsInfo* rdsInfo);
+    void getRDSStats(RdsStats* rdsStats);
+    void resetRDSStats();
+    void getSnapshotStats(uint32_t* hits, uint32_t* reads);
+    void resetSnapshotStats();
     void power(uint8_t mode);
     void setAGC(uint8_t start);
     void setiMS(uint16_t mph);
@@ -64,5 +110,15 @@ class TEF6686 {
     uint8_t isRdsNewRadioText;
     uint8_t prevAddress = 3; uint8_t rdsAb;
     uint8_t psCharIsSet = 0;
+    uint16_t rtSegments;
+    uint8_t rtCrSegment = 0xFF;
+    uint32_t rdsClearTime;
+    TEF_GET_REQUEST rdsRequest;
+    bool rdsRequested = false;
+    RdsStats stats;
+    TunerSnapshot snapshot = {0, 0, 0, 0, 0, 0, 0, false, {0, 0, TEF6686_QUALITY_MAXAGE, false}, false, {0, 0, TEF6686_STEREO_MAXAGE, false}, 0, 0};
+    bool snapshotFresh(TunerSnapshotField &field);
+    void snapshotStore(TunerSnapshotField &field);
+    bool getQuality(bool am);
     void rdsFormatString(char* str, uint16_t length);
 };
@@ -140,6 +140,48 @@
   MODE LONG PRESS: Open menu
   BW SHORT PRESS: Switch bandwidth setting
   BW LONG PRESS: Switch mono, or auto stereo
+
+  Serial diagnostics (send over USB, 115200 baud):
+  Li: I2C usage since last reset
+      Li,loops,ms,writes,reads,bytes,bus ms,wait ms,us per loop,
+      bus busy %,bus and wait %,repeated start reads
+  Lm: Memory usage in bytes
+      Lm,heap size,free heap,lowest free heap,largest free block,
+      fragmentation %,sketch size,free sketch space
+  Lp: loop() profile, one line per probe, times in us
+      Lp,name,count,min,avg,max,p99
+      XDRcommand is the time from a received command line to its
+      complete reply, XDRstatus counts and times the status lines,
+      Diagnostics times these L commands
+  Lb: Boot timeline, one line per setup() phase, times in us since power on
+      Lb,phase,end time,duration
+      followed by Lb,dropped,count when phases did not fit the timeline
+  Lc: Tuner command cache, writes dropped as unchanged and writes sent
+      Lc,hits,misses
+  Ls: Tuner status snapshot, status requests served from the snapshot
+      and requests that read the tuner
+      Ls,hits,reads
+  Lg: RDS decoder since last reset, times since last RDS clear (tune)
+      Lg,groups,groups with errors,groups per s,ms,ms to PS,ms to RT
+      (0 = PS or RT not complete yet)
+  Le: I2C errors since last reset: a totals line, then one line per
+      command (module in hex, command number; module below 20 is
+      boot/patch traffic). Failed transactions are retried twice,
+      with a bus recovery first when SDA is stuck low.
+      Le,failed,retries,bus recoveries
+      Le,module,command,transactions,failed,retries
+  Lk: Clock profile used for XDR-GTK scans and seek, with scan times
+      per profile since last reset (us per step includes waiting
+      until the tuner reports 10 ms of quality time since the tune,
+      at most 50 ms, and the serial output)
+      Lk,profile,selected,scans,steps,ms,us per step
+      Lk1/Lk0: Select the fast (400 kHz) or quiet (100 kHz) profile
+  Lt1/Lt0: Start/stop capturing I2C transactions (last 256 are kept)
+  Ld: Dump captured I2C transactions, binary:
+      "Ld", count (2 bytes), then per transaction:
+      time us (4), flags (1: bit0 read, bit1 ok, bit2 not the tuner),
+      length (1), data (up to 16 bytes), all big endian, closed by "\n"
+  Lr: Reset all diagnostic counters
 * ***********************************************
 
 
@@ -163,6 +205,7 @@
 */
 
 #include "TEF6686.h"
+#include "Profiler.h"
 #include "constants.h"
 #include <EEPROM.h>
 #include <Wire.h>
@@ -220,6 +263,8 @@ bool store;
 bool tunemode = false;
 bool USBstatus = false;
 bool XDRMute;
+bool buff_overflow;
+bool statusvalid;
 byte band;
 byte BWset;
 byte ContrastSet;
@@ -239,7 +284,7 @@ byte optenc;
 char buff[16];
 char programServicePrevious[9];
 char programTypePrevious[17];
-char radioIdPrevious[4];
+char radioIdPrevious[5];
 char radioTextPrevious[65];
 int AGC;
 int BWOld;
@@ -305,6 +350,13 @@ unsigned int scanner_end;
 unsigned int scanner_start;
 unsigned int scanner_step;
 unsigned long peakholdmillis;
+unsigned long loopcount;
+unsigned long diagmillis;
+RTC_NOINIT_ATTR uint32_t settingsfingerprint;
+TUNER_CLOCK_PROFILE scanclock = TUNER_CLOCK_FAST;
+unsigned long scanms[2];
+unsigned long scansteps[2];
+unsigned int scancount[2];
 
 TEF6686 radio;
 RdsInfo rdsInfo;
@@ -359,6 +411,7 @@ void setup() {
   TEF = EEPROM.readByte(54);
   optenc = EEPROM.readByte(55);
   EEPROM.commit();
+  Profiler_Mark("EEPROM");
   encoder.begin();
   btStop();
   Serial.begin(115200);
@@ -390,6 +443,7 @@ void setup() {
     tft.setRotation(1);
 #endif
   }
+  Profiler_Mark("display init");
 
   TEF = EEPROM.readByte(54);
 
@@ -397,21 +451,23 @@ void setup() {
     SetTunerPatch();
   }
 
-  radio.init(TEF);
+  bool warmstart = radio.init(TEF);
   uint16_t device;
   uint16_t hw;
   uint16_t sw;
+  uint8_t version;
   radio.getIdentification(device, hw, sw);
-  if (TEF != (highByte(hw) * 100 + highByte(sw))) {
+  version = highByte(hw) * 100 + highByte(sw);
+  if (TEF != version) {
     SetTunerPatch();
+    warmstart = radio.init(TEF);
+    radio.getIdentification(device, hw, sw);
+    version = highByte(hw) * 100 + highByte(sw);
   }
 
   analogWrite(CONTRASTPIN, ContrastSet * 2 + 27);
   analogWrite(SMETERPIN, 0);
-
-  uint8_t version;
-  radio.getIdentification(device, hw, sw);
-  version = highByte(hw) * 100 + highByte(sw);
+  Profiler_Mark("identification");
 
   pinMode(MODEBUTTON, INPUT);
   pinMode(BWBUTTON, INPUT);
@@ -510,27 +566,33 @@ void setup() {
     for (;;);
   }
   tft.drawString("Patch: v" + String(TEF), 80, 75, 2);
-  delay(1500);
+  Profiler_Mark("splash screen");
+  if (warmstart == false) {
+    delay(1500);
+  }
+  Profiler_Mark("splash wait");
 
-  radio.setVolume(VolSet);
-  radio.setOffset(LevelOffset);
-  radio.setStereoLevel(StereoLevel);
-  radio.setHighCutLevel(HighCutLevel);
-  radio.setHighCutOffset(HighCutOffset);
+  if (warmstart == false || settingsfingerprint != SettingsFingerprint()) {
+    radio.setVolume(VolSet);
+    radio.setOffset(LevelOffset);
+    radio.setStereoLevel(StereoLevel);
+    radio.setHighCutLevel(HighCutLevel);
+    radio.setHighCutOffset(HighCutOffset);
+    settingsfingerprint = SettingsFingerprint();
+  }
   radio.clearRDS();
   radio.setMute();
   LowLevelInit = true;
+  Profiler_Mark("settings");
 
   if (ConverterSet >= 200) {
-    Wire.beginTransmission(0x12);
-    Wire.write(ConverterSet >> 8);
-    Wire.write(ConverterSet & (0xFF));
-    Wire.endTransmission();
+    SetConverter();
   }
 
   SelectBand();
   ShowSignalLevel();
   ShowBW();
+  Profiler_Mark("select band");
   setupmode = false;
   attachInterrupt(digitalPinToInterrupt(ROTARY_PIN_A),  encoderISR,       CHANGE);
   attachInterrupt(digitalPinToInterrupt(ROTARY_PIN_B),  encoderISR,       CHANGE);
@@ -538,6 +600,8 @@ void setup() {
 }
 
 void loop() {
+  ProfileTimer timer(PROF_LOOP);
+  loopcount++;
   if (digitalRead(PWRBUTTON) == LOW && USBstatus == false) {
     PWRButtonPress();
   }
@@ -547,6 +611,9 @@ void loop() {
     if (seek == true) {
       Seek(direction);
     }
+    if (seek == false) {
+      Tuner_SetClock(TUNER_CLOCK_QUIET);
+    }
 
     if (SStatus / 10 > LowLevelSet && LowLevelInit == false && menu == false && band == 0) {
       radio.clearRDS();
@@ -610,9 +677,11 @@ void loop() {
       if (millis() >= lowsignaltimer + 300) {
         lowsignaltimer = millis();
         if (band == 0) {
-          radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus);
+          ProfileTimer timer(PROF_GETSTATUS);
+          statusvalid = radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus);
         } else {
-          radio.getStatus_AM(SStatus, USN, WAM, OStatus, BW, MStatus);
+          ProfileTimer timer(PROF_GETSTATUS);
+          statusvalid = radio.getStatus_AM(SStatus, USN, WAM, OStatus, BW, MStatus);
         }
         if (screenmute == true) {
           readRds();
@@ -623,13 +692,20 @@ void loop() {
       }
     } else {
       if (band == 0) {
-        radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus);
+        ProfileTimer timer(PROF_GETSTATUS);
+        statusvalid = radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus);
       } else {
-        radio.getStatus_AM(SStatus, USN, WAM, OStatus, BW, MStatus);
+        ProfileTimer timer(PROF_GETSTATUS);
+        statusvalid = radio.getStatus_AM(SStatus, USN, WAM, OStatus, BW, MStatus);
       }
       if (menu == false) {
         doSquelch();
         readRds();
+        // The I2C engine fetches the next group while the screen is drawn,
+        // the next readRds() collects it
+        if (band == 0) {
+          radio.requestRDS();
+        }
         if (screenmute == false) {
           ShowModLevel();
         }
@@ -1289,6 +1365,7 @@ void KeyUp() {
           }
           tft.drawRightString(VolString, 165, 110, 4);
           radio.setVolume(VolSet);
+          settingsfingerprint = 0;
           break;
 
         case 50:
@@ -1304,10 +1381,7 @@ void KeyUp() {
             }
           }
           if (ConverterSet >= 200) {
-            Wire.beginTransmission(0x12);
-            Wire.write(ConverterSet >> 8);
-            Wire.write(ConverterSet & (0xFF));
-            Wire.endTransmission();
+            SetConverter();
           }
           tft.setTextColor(TFT_YELLOW);
           ConverterString = String(ConverterSet, DEC);
@@ -1360,6 +1434,7 @@ void KeyUp() {
           }
           tft.drawRightString(LevelOffsetString, 165, 110, 4);
           radio.setOffset(LevelOffset);
+          settingsfingerprint = 0;
           change2 = true;
           break;
 
@@ -1390,6 +1465,7 @@ void KeyUp() {
           tft.setTextColor(TFT_YELLOW);
           tft.drawRightString(StereoLevelString, 165, 110, 4);
           radio.setStereoLevel(StereoLevel);
+          settingsfingerprint = 0;
           break;
 
         case 150:
@@ -1404,6 +1480,7 @@ void KeyUp() {
           tft.setTextColor(TFT_YELLOW);
           tft.drawRightString(HighCutLevelString, 165, 110, 4);
           radio.setHighCutLevel(HighCutLevel);
+          settingsfingerprint = 0;
           break;
 
         case 170:
@@ -1433,6 +1510,7 @@ void KeyUp() {
           tft.setTextColor(TFT_YELLOW);
           tft.drawRightString(HighCutOffsetString, 165, 110, 4);
           radio.setHighCutOffset(HighCutOffset);
+          settingsfingerprint = 0;
           break;
 
         case 190:
@@ -1529,6 +1607,7 @@ void KeyDown() {
           }
           tft.drawRightString(VolString, 165, 110, 4);
           radio.setVolume(VolSet);
+          settingsfingerprint = 0;
           break;
 
         case 50:
@@ -1544,10 +1623,7 @@ void KeyDown() {
             }
           }
           if (ConverterSet >= 200) {
-            Wire.beginTransmission(0x12);
-            Wire.write(ConverterSet >> 8);
-            Wire.write(ConverterSet & (0xFF));
-            Wire.endTransmission();
+            SetConverter();
           }
           tft.setTextColor(TFT_YELLOW);
           ConverterString = String(ConverterSet, DEC);
@@ -1600,6 +1676,7 @@ void KeyDown() {
           }
           tft.drawRightString(LevelOffsetString, 165, 110, 4);
           radio.setOffset(LevelOffset);
+          settingsfingerprint = 0;
           change2 = true;
           break;
 
@@ -1631,6 +1708,7 @@ void KeyDown() {
           tft.setTextColor(TFT_YELLOW);
           tft.drawRightString(StereoLevelString, 165, 110, 4);
           radio.setStereoLevel(StereoLevel);
+          settingsfingerprint = 0;
           break;
 
         case 150:
@@ -1645,6 +1723,7 @@ void KeyDown() {
           tft.setTextColor(TFT_YELLOW);
           tft.drawRightString(HighCutLevelString, 165, 110, 4);
           radio.setHighCutLevel(HighCutLevel);
+          settingsfingerprint = 0;
           break;
 
         case 170:
@@ -1675,6 +1754,7 @@ void KeyDown() {
           tft.setTextColor(TFT_YELLOW);
           tft.drawRightString(HighCutOffsetString, 165, 110, 4);
           radio.setHighCutOffset(HighCutOffset);
+          settingsfingerprint = 0;
           break;
 
         case 190:
@@ -1718,6 +1798,7 @@ void KeyDown() {
 
 
 void readRds() {
+  ProfileTimer timer(PROF_READRDS);
   if (band == 0) {
     radio.getRDS(&rdsInfo);
     RDSstatus = radio.readRDS(rdsB, rdsC, rdsD, rdsErr);
@@ -1750,6 +1831,7 @@ void readRds() {
 }
 
 void showPI() {
+  ProfileTimer timer(PROF_SHOWPI);
   if ((RDSstatus == 1) && !strcmp(rdsInfo.programId, radioIdPrevious, 4)) {
     tft.setTextColor(TFT_BLACK);
     tft.drawString(PIold, 244, 192, 4);
@@ -1761,6 +1843,7 @@ void showPI() {
 }
 
 void showPTY() {
+  ProfileTimer timer(PROF_SHOWPTY);
   if ((RDSstatus == 1) && !strcmp(rdsInfo.programType, programTypePrevious, 16)) {
     tft.setTextColor(TFT_BLACK);
     tft.drawString(PTYold, 38, 168, 2);
@@ -1772,6 +1855,7 @@ void showPTY() {
 }
 
 void showPS() {
+  ProfileTimer timer(PROF_SHOWPS);
   if (SStatus / 10 > LowLevelSet) {
     if ((RDSstatus == 1) && (strlen(rdsInfo.programService) == 8) && !strcmp(rdsInfo.programService, programServicePrevious, 8)) {
       tft.setTextColor(TFT_BLACK);
@@ -1786,6 +1870,7 @@ void showPS() {
 
 
 void showRadioText() {
+  ProfileTimer timer(PROF_SHOWRADIOTEXT);
   if ((RDSstatus == 1) && !strcmp(rdsInfo.radioText, radioTextPrevious, 65)) {
     tft.setTextColor(TFT_BLACK);
     tft.drawString(RTold, 6, 222, 2);
@@ -2095,6 +2180,7 @@ void ShowFreq(int mode)
 
 void ShowSignalLevel()
 {
+  ProfileTimer timer(PROF_SHOWSIGNALLEVEL);
   if (band == 0) {
     SNR = int(0.46222375 * (float)(SStatus / 10) - 0.082495118 * (float)(USN / 10)) + 10;
   } else {
@@ -2228,6 +2314,7 @@ void ShowRDSLogo(bool RDSstatus)
 
 void ShowStereoStatus()
 {
+  ProfileTimer timer(PROF_SHOWSTEREOSTATUS);
   if (StereoToggle == true)
   {
     if (band == 0) {
@@ -2258,6 +2345,7 @@ void ShowStereoStatus()
 
 void ShowOffset()
 {
+  ProfileTimer timer(PROF_SHOWOFFSET);
   if (OStatus != OStatusold) {
     if (band == 0) {
       if (OStatus < -500)
@@ -2364,6 +2452,7 @@ void ShowOffset()
 
 void ShowBW()
 {
+  ProfileTimer timer(PROF_SHOWBW);
   if (BW != BWOld || BWreset == true)
   {
     String BWString = String (BW, DEC);
@@ -2383,6 +2472,7 @@ void ShowBW()
 
 void ShowModLevel()
 {
+  ProfileTimer timer(PROF_SHOWMODLEVEL);
   int segments;
   int color;
   int hold = 0;
@@ -2426,6 +2516,7 @@ void ShowModLevel()
 }
 
 void doSquelch() {
+  ProfileTimer timer(PROF_DOSQUELCH);
   if (USBstatus == false) {
     Squelch = analogRead(PIN_POT) / 4 - 100;
     if (Squelch > 920) {
@@ -2710,14 +2801,21 @@ void ShowUSBstatus() {
 }
 
 void XDRGTKRoutine() {
+  ProfileTimer timer(PROF_XDRGTKROUTINE);
   if (Serial.available() > 0)
   {
     buff[buff_pos] = Serial.read();
     if (buff[buff_pos] != '\n' && buff_pos != 16 - 1)
       buff_pos++;
-    else {
+    else if (buff[buff_pos] != '\n' || buff_overflow) {
+      // Line did not fit in buff: drop it up to the next newline instead of running the pieces
+      buff_overflow = (buff[buff_pos] != '\n');
+      buff_pos = 0;
+    } else {
       buff[buff_pos] = 0;
       buff_pos = 0;
+      // L dumps are booked apart so they do not skew the command latency
+      ProfileTimer command((buff[0] == 'L') ? PROF_DIAGNOSTICS : PROF_XDRCOMMAND);
       switch (buff[0])
       {
         case 'x':
@@ -2946,7 +3044,7 @@ void XDRGTKRoutine() {
           } else if (buff[1] == 'f')
           {
             scanner_filter = atol(buff + 2);
-          } else if (scanner_start > 0 && scanner_end > 0 && scanner_step > 0 && scanner_filter >= 0)
+          } else if (scanner_start >= 6500 && scanner_end <= 10800 && scanner_start <= scanner_end && scanner_step > 0 && scanner_filter >= 0)
           {
             frequencyold = radio.getFrequency();
             radio.setFrequency(scanner_start, 65, 108);
@@ -2995,21 +3093,32 @@ void XDRGTKRoutine() {
               tft.print("SCANNING...");
             }
             frequencyold = frequency / 10;
+            Tuner_SetClock(scanclock);
+            unsigned long scanstart;
+            scanstart = millis();
             for (freq_scan = scanner_start; freq_scan <= scanner_end; freq_scan += scanner_step)
             {
+              scansteps[scanclock]++;
               radio.setFrequency(freq_scan, 65, 108);
-              Serial.print(freq_scan * 10, DEC);
-              Serial.print('=');
-              delay(10);
+              // Only the level is reported: same 10 ms settling as before,
+              // but counted by the tuner from the tune itself
+              bool valid = radio.waitForValidQuality(band != 0, 100, 50);
               if (band == 0) {
-                radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus);
+                valid = radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus) && valid;
               } else {
-                radio.getStatus_AM(SStatus, USN, WAM, OStatus, BW, MStatus);
+                valid = radio.getStatus_AM(SStatus, USN, WAM, OStatus, BW, MStatus) && valid;
+              }
+              // A step that could not be read is left out of the scan
+              if (valid) {
+                Serial.print(freq_scan * 10, DEC);
+                Serial.print('=');
+                Serial.print((SStatus / 10) + 10, DEC);
+                Serial.print(',');
               }
-              Serial.print((SStatus / 10) + 10, DEC);
-              Serial.print(',');
             }
             Serial.print('\n');
+            scanms[scanclock] += millis() - scanstart;
+            scancount[scanclock]++;
             if (screenmute == false) {
               tft.setTextFont(4);
               tft.setTextColor(TFT_BLACK);
@@ -3017,6 +3126,7 @@ void XDRGTKRoutine() {
               tft.print("SCANNING...");
             }
             radio.setFrequency(frequencyold, 65, 108);
+            Tuner_SetClock(TUNER_CLOCK_QUIET);
             if (screenmute == false) {
               ShowFreq(0);
             }
@@ -3034,6 +3144,7 @@ void XDRGTKRoutine() {
             radio.setVolume((VolSet - 70) / 10);
             XDRMute = false;
           }
+          settingsfingerprint = 0;
           Serial.print("Y");
           Serial.print(VolSet);
           Serial.print("\n");
@@ -3044,6 +3155,10 @@ void XDRGTKRoutine() {
           ESP.restart();
           break;
 
+        case 'L':
+          Diagnostics(buff[1]);
+          break;
+
         case 'Z':
           byte iMSEQX;
           iMSEQX = atol(buff + 1);
@@ -3077,7 +3192,9 @@ void XDRGTKRoutine() {
     }
   }
 
-  if (USBstatus == true) {
+  // No status line from a failed tuner read
+  if (USBstatus == true && statusvalid == true) {
+    ProfileTimer status(PROF_XDRSTATUS);
     Stereostatus = radio.getStereoStatus();
     Serial.print("S");
     if (StereoToggle == false) {
@@ -3105,15 +3222,229 @@ void serial_hex(uint8_t val) {
   Serial.print(val & 0xF, HEX);
 }
 
+void Diagnostics(char item) {
+  switch (item) {
+    case 'i':
+      TUNER_BUS_STATS bus;
+      Tuner_GetBusStats(&bus);
+      Serial.print("Li,");
+      Serial.print(loopcount);
+      Serial.print(',');
+      Serial.print(millis() - diagmillis);
+      Serial.print(',');
+      Serial.print(bus.writes);
+      Serial.print(',');
+      Serial.print(bus.reads);
+      Serial.print(',');
+      Serial.print(bus.bytes);
+      Serial.print(',');
+      Serial.print(bus.bus_us / 1000);
+      Serial.print(',');
+      Serial.print(bus.wait_us / 1000);
+      Serial.print(',');
+      Serial.print(loopcount > 0 ? (bus.bus_us + bus.wait_us) / loopcount : 0);
+      Serial.print(',');
+      Serial.print(millis() > diagmillis ? bus.bus_us / 10 / (millis() - diagmillis) : 0);
+      Serial.print(',');
+      Serial.print(millis() > diagmillis ? (bus.bus_us + bus.wait_us) / 10 / (millis() - diagmillis) : 0);
+      Serial.print(',');
+      Serial.print(bus.writereads);
+      Serial.print("\n");
+      break;
+
+    case 'm':
+      Serial.print("Lm,");
+      Serial.print(ESP.getHeapSize());
+      Serial.print(',');
+      Serial.print(ESP.getFreeHeap());
+      Serial.print(',');
+      Serial.print(ESP.getMinFreeHeap());
+      Serial.print(',');
+      Serial.print(ESP.getMaxAllocHeap());
+      Serial.print(',');
+      Serial.print(100 - ESP.getMaxAllocHeap() * 100 / ESP.getFreeHeap());
+      Serial.print(',');
+      Serial.print(ESP.getSketchSize());
+      Serial.print(',');
+      Serial.print(ESP.getFreeSketchSpace());
+      Serial.print("\n");
+      break;
+
+    case 'p':
+      PROFILER_RESULT result;
+      for (uint8_t i = 0; i < PROF_COUNT; i++) {
+        Profiler_Get((PROFILER_PROBE)i, &result);
+        Serial.print("Lp,");
+        Serial.print(Profiler_Name((PROFILER_PROBE)i));
+        Serial.print(',');
+        Serial.print(result.count);
+        Serial.print(',');
+        Serial.print(result.min);
+        Serial.print(',');
+        Serial.print(result.avg);
+        Serial.print(',');
+        Serial.print(result.max);
+        Serial.print(',');
+        Serial.print(result.p99);
+        Serial.print("\n");
+      }
+      break;
+
+    case 'b':
+      PROFILER_MARK mark, before;
+      for (uint8_t i = 0; Profiler_GetMark(i, &mark); i++) {
+        Serial.print("Lb,");
+        Serial.print(mark.name);
+        Serial.print(',');
+        Serial.print(mark.time);
+        Serial.print(',');
+        Serial.print(i > 0 ? mark.time - before.time : mark.time);
+        Serial.print("\n");
+        before = mark;
+      }
+      if (Profiler_MarksDropped() > 0) {
+        Serial.print("Lb,dropped,");
+        Serial.print(Profiler_MarksDropped());
+        Serial.print("\n");
+      }
+      break;
+
+    case 'c':
+      uint32_t hits, misses;
+      devTEF_Shadow_Stats(&hits, &misses);
+      Serial.print("Lc,");
+      Serial.print(hits);
+      Serial.print(',');
+      Serial.print(misses);
+      Serial.print("\n");
+      break;
+
+    case 's':
+      uint32_t snapshothits, snapshotreads;
+      radio.getSnapshotStats(&snapshothits, &snapshotreads);
+      Serial.print("Ls,");
+      Serial.print(snapshothits);
+      Serial.print(',');
+      Serial.print(snapshotreads);
+      Serial.print("\n");
+      break;
+
+    case 'g':
+      RdsStats rdsStats;
+      radio.getRDSStats(&rdsStats);
+      Serial.print("Lg,");
+      Serial.print(rdsStats.groups);
+      Serial.print(',');
+      Serial.print(rdsStats.errorGroups);
+      Serial.print(',');
+      Serial.print(millis() > diagmillis ? rdsStats.groups * 1000 / (millis() - diagmillis) : 0);
+      Serial.print(',');
+      Serial.print(millis() - diagmillis);
+      Serial.print(',');
+      Serial.print(rdsStats.psTime);
+      Serial.print(',');
+      Serial.print(rdsStats.rtTime);
+      Serial.print("\n");
+      break;
+
+    case 'e':
+      TUNER_BUS_STATS errors;
+      TUNER_CMD_STATS cmd;
+      Tuner_GetBusStats(&errors);
+      Serial.print("Le,");
+      Serial.print(errors.errors);
+      Serial.print(',');
+      Serial.print(errors.retries);
+      Serial.print(',');
+      Serial.print(errors.recoveries);
+      Serial.print("\n");
+      for (uint8_t i = 0; Tuner_GetCmdStats(i, &cmd); i++) {
+        Serial.print("Le,");
+        Serial.print(cmd.module, HEX);
+        Serial.print(',');
+        Serial.print(cmd.cmd);
+        Serial.print(',');
+        Serial.print(cmd.count);
+        Serial.print(',');
+        Serial.print(cmd.errors);
+        Serial.print(',');
+        Serial.print(cmd.retries);
+        Serial.print("\n");
+      }
+      break;
+
+    case 'k':
+      if (buff[2] == '0' || buff[2] == '1') {
+        scanclock = (buff[2] == '1') ? TUNER_CLOCK_FAST : TUNER_CLOCK_QUIET;
+      }
+      for (uint8_t i = 0; i < 2; i++) {
+        Serial.print("Lk,");
+        Serial.print(i == TUNER_CLOCK_FAST ? "fast" : "quiet");
+        Serial.print(',');
+        Serial.print(scanclock == i ? 1 : 0);
+        Serial.print(',');
+        Serial.print(scancount[i]);
+        Serial.print(',');
+        Serial.print(scansteps[i]);
+        Serial.print(',');
+        Serial.print(scanms[i]);
+        Serial.print(',');
+        Serial.print(scansteps[i] > 0 ? scanms[i] * 1000 / scansteps[i] : 0);
+        Serial.print("\n");
+      }
+      break;
+
+    case 't':
+      Tuner_Trace(buff[2] == '1');
+      Serial.print("Lt");
+      Serial.print(buff[2] == '1' ? 1 : 0);
+      Serial.print("\n");
+      break;
+
+    case 'd':
+      TUNER_TRACE_ENTRY entry;
+      Serial.print("Ld");
+      Serial.write(highByte(Tuner_TraceCount()));
+      Serial.write(lowByte(Tuner_TraceCount()));
+      for (uint16_t i = 0; Tuner_TraceGet(i, &entry); i++) {
+        Serial.write(entry.time >> 24);
+        Serial.write(entry.time >> 16);
+        Serial.write(entry.time >> 8);
+        Serial.write(entry.time);
+        Serial.write(entry.flags);
+        Serial.write(entry.len);
+        Serial.write(entry.data, (entry.len > TUNER_TRACE_DATA) ? TUNER_TRACE_DATA : entry.len);
+      }
+      Serial.print("\n");
+      break;
+
+    case 'r':
+      Tuner_ResetBusStats();
+      Profiler_Reset();
+      radio.resetRDSStats();
+      devTEF_Shadow_Reset_Stats();
+      radio.resetSnapshotStats();
+      memset(scanms, 0, sizeof(scanms));
+      memset(scansteps, 0, sizeof(scansteps));
+      memset(scancount, 0, sizeof(scancount));
+      loopcount = 0;
+      diagmillis = millis();
+      Serial.print("Lr\n");
+      break;
+  }
+}
+
+// Every step runs at the scan clock profile, whether started from loop(),
+// the keys or XDR 'C', until a station is found
 void Seek(bool mode) {
   if (band == 0) {
+    Tuner_SetClock(scanclock);
     radio.setMute();
     if (mode == false) {
       frequency = radio.tuneDown(stepsize, LowEdgeSet, HighEdgeSet);
     } else {
       frequency = radio.tuneUp(stepsize, LowEdgeSet, HighEdgeSet);
     }
-    delay(50);
     ShowFreq(0);
     if (USBstatus == true) {
       if (band == 0) {
@@ -3123,10 +3454,12 @@ void Seek(bool mode) {
       }
     }
 
-    radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus);
+    bool valid = radio.waitForValidQuality(false, TEF6686_QUALITY_READY, 100);
+    valid = radio.getStatus(SStatus, USN, WAM, OStatus, BW, MStatus) && valid;
 
-    if ((USN < 200) && (WAM < 230) && (OStatus < 80 && OStatus > -80) && (Squelch < SStatus || Squelch == 920)) {
+    if (valid && (USN < 200) && (WAM < 230) && (OStatus < 80 && OStatus > -80) && (Squelch < SStatus || Squelch == 920)) {
       seek = false;
+      Tuner_SetClock(TUNER_CLOCK_QUIET);
       radio.setUnMute();
       store = true;
     } else {
@@ -3135,26 +3468,42 @@ void Seek(bool mode) {
   }
 }
 
+uint32_t SettingsFingerprint() {
+  int settings[] = {TEF, VolSet, LevelOffset, StereoLevel, HighCutLevel, HighCutOffset};
+  uint32_t hash = 2166136261UL;
+  for (uint8_t i = 0; i < sizeof(settings); i++) {
+    hash = (hash ^ ((uint8_t *)settings)[i]) * 16777619UL;
+  }
+  return hash;
+}
+
+// The converter shares the tuner bus, so its writes go through the I2C engine
+void SetConverter() {
+  unsigned char buf[] = {(unsigned char)(ConverterSet >> 8), (unsigned char)(ConverterSet & 0xFF)};
+  Tuner_WriteDevice(0x12, buf, sizeof(buf));
+}
+
 void SetTunerPatch() {
+  uint16_t device;
+  uint16_t hw;
+  uint16_t sw;
+  radio.init(102);
+  radio.getIdentification(device, hw, sw);
+  TEF = highByte(hw) * 100 + highByte(sw);
   if (TEF != 101 && TEF != 102 && TEF != 205) {
-    radio.init(102);
-    uint16_t device;
-    uint16_t hw;
-    uint16_t sw;
-    radio.getIdentification(device, hw, sw);
-    TEF = highByte(hw) * 100 + highByte(sw);
     tft.fillScreen(TFT_BLACK);
     tft.setTextColor(TFT_WHITE);
     analogWrite(CONTRASTPIN, ContrastSet * 2 + 27);
     if (TEF == 0) {
       tft.drawCentreString("Tuner not detected", 150, 70, 4);
     } else {
-      tft.drawCentreString(String("Tuner version set: v") + String(TEF), 150, 70, 4);
+      tft.drawCentreString(String("Tuner version v") + String(TEF), 150, 70, 4);
+      tft.drawCentreString("is not supported", 150, 100, 4);
     }
-    tft.drawCentreString("Please restart tuner", 150, 100, 4);
-    EEPROM.writeByte(54, TEF);
-    EEPROM.commit();
     while (true);
     for (;;);
   }
+  EEPROM.writeByte(54, TEF);
+  EEPROM.commit();
+  settingsfingerprint = 0;
 }
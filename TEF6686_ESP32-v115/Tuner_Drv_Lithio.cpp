@@ -1,35 +1,83 @@
 #include "TEF6686.h"
-#include <stdarg.h>
 
 #define High_16bto8b(a)  ((uint8_t)((a) >> 8))
 #define Low_16bto8b(a)  ((uint8_t)(a ))
 #define Convert8bto16b(a) ((uint16_t)(((uint16_t)(*(a))) << 8 |((uint16_t)(*(a+1)))))
 
-bool devTEF_Set_Cmd(TEF_MODULE module, uint8_t cmd, uint16_t len, ...)
+#define SHADOW_ENTRIES 24
+#define SHADOW_FRAME   20
+
+typedef struct
+{ uint8_t module;
+  uint8_t cmd;
+  uint8_t len;
+  uint8_t frame[SHADOW_FRAME];
+} TEF_SHADOW_ENTRY;
+
+static TEF_SHADOW_ENTRY shadow[SHADOW_ENTRIES];
+static uint32_t shadow_hits;
+static uint32_t shadow_misses;
+
+// Shadow entry of this module/command, claimed on first use. len 0 means the
+// chip state is unknown. Tuning and operation mode changes are never cached:
+// repeating those is intentional.
+static TEF_SHADOW_ENTRY *devTEF_Shadow_Find(uint8_t *buf, uint16_t len)
 {
-  uint16_t i;
-  uint8_t buf[20];
-  uint16_t temp;
-  va_list vArgs;
+  if (buf[0] == TEF_APPL || buf[1] == Cmd_Tune_To || len > SHADOW_FRAME) {
+    return NULL;
+  }
+  for (uint8_t i = 0; i < SHADOW_ENTRIES; i++) {
+    if (shadow[i].module == 0) {
+      shadow[i].module = buf[0];
+      shadow[i].cmd = buf[1];
+      shadow[i].len = 0;
+      return &shadow[i];
+    }
+    if (shadow[i].module == buf[0] && shadow[i].cmd == buf[1]) {
+      return &shadow[i];
+    }
+  }
+  return NULL;
+}
 
-  va_start(vArgs, len);
+bool devTEF_Write_Frame(uint8_t *buf, uint16_t len)
+{
+  TEF_SHADOW_ENTRY *entry = devTEF_Shadow_Find(buf, len);
 
-  buf[0] = module;
-  buf[1] = cmd;
-  buf[2] = 1;
+  if (entry != NULL && entry->len == len && memcmp(entry->frame, buf, len) == 0) {
+    shadow_hits++;
+    return true;
+  }
+  shadow_misses++;
 
-  for (i = 3; i < len; i++)
-  {
-    temp = va_arg(vArgs, int);
-    buf[i++] = High_16bto8b(temp);
-    buf[i] = Low_16bto8b(temp);
+  bool r = Tuner_WriteBuffer(buf, len);
+  if (entry != NULL) {
+    entry->len = r ? len : 0;
+    memcpy(entry->frame, buf, len);
   }
+  return r;
+}
 
-  va_end(vArgs);
+void devTEF_Shadow_Invalidate(void)
+{
+  memset(shadow, 0, sizeof(shadow));
+}
 
-  return Tuner_WriteBuffer(buf, len);
+void devTEF_Shadow_Stats(uint32_t *hits, uint32_t *misses)
+{
+  *hits = shadow_hits;
+  *misses = shadow_misses;
+}
+
+void devTEF_Shadow_Reset_Stats(void)
+{
+  shadow_hits = 0;
+  shadow_misses = 0;
 }
 
+// Set by devTEF_Get_Cmd_SelfTest once the tuner answers repeated start reads correctly
+static bool repeatedstart;
+static uint8_t repeatedstart_failures;
 
 bool devTEF_Get_Cmd(TEF_MODULE module, uint8_t cmd, uint8_t *receive, uint16_t len)
 {
@@ -39,108 +87,179 @@ bool devTEF_Get_Cmd(TEF_MODULE module, uint8_t cmd, uint8_t *receive, uint16_t l
   buf[1] = cmd;
   buf[2] = 1;
 
-  Tuner_WriteBuffer(buf, 3);
-  return Tuner_ReadBuffer(receive, len);
+  if (repeatedstart) {
+    if (Tuner_WriteReadBuffer(buf, 3, receive, len)) {
+      repeatedstart_failures = 0;
+      return true;
+    }
+    if (++repeatedstart_failures >= 3) {
+      repeatedstart = false;
+    }
+  }
+
+  if (Tuner_WriteBuffer(buf, 3) && Tuner_ReadBuffer(receive, len)) {
+    return true;
+  }
+  // Never hand out whatever was in the caller's buffer as a reading
+  memset(receive, 0, len);
+  return false;
+}
+
+// Reads the identification both ways and only enables repeated start reads when they agree
+bool devTEF_Get_Cmd_SelfTest(void)
+{
+  uint8_t buf[3] = {TEF_APPL, Cmd_Get_Identification, 1};
+  uint8_t separate[6];
+  uint8_t combined[6];
+
+  repeatedstart = false;
+  repeatedstart_failures = 0;
+  if (devTEF_Get_Cmd(TEF_APPL, Cmd_Get_Identification, separate, sizeof(separate)) &&
+      Tuner_WriteReadBuffer(buf, sizeof(buf), combined, sizeof(combined)) &&
+      memcmp(separate, combined, sizeof(separate)) == 0) {
+    repeatedstart = true;
+  }
+  return repeatedstart;
+}
+
+// Queues the command and its read as one repeated start transaction. Without
+// repeated start, or with the queue full, the reply is read right away.
+bool devTEF_Get_Cmd_Submit(TEF_GET_REQUEST *get, TEF_MODULE module, uint8_t cmd, uint16_t len)
+{
+  get->cmd[0] = module;
+  get->cmd[1] = cmd;
+  get->cmd[2] = 1;
+  get->request.address = TUNER_I2C_ADDRESS;
+  get->request.wbuf = get->cmd;
+  get->request.wlen = 3;
+  get->request.rbuf = get->reply;
+  get->request.rlen = len;
+
+  if (repeatedstart && Tuner_Submit(&get->request)) {
+    get->queued = true;
+    return true;
+  }
+  get->queued = false;
+  get->request.result = devTEF_Get_Cmd(module, cmd, get->reply, len);
+  return get->request.result;
+}
+
+// Waits for a queued reply; a failed one is read again the slow way
+bool devTEF_Get_Cmd_Collect(TEF_GET_REQUEST *get)
+{
+  if (!get->queued) {
+    return get->request.result;
+  }
+  get->queued = false;
+  if (Tuner_Wait(&get->request)) {
+    repeatedstart_failures = 0;
+    return true;
+  }
+  if (++repeatedstart_failures >= 3) {
+    repeatedstart = false;
+  }
+  return devTEF_Get_Cmd((TEF_MODULE)get->cmd[0], get->cmd[1], get->reply, get->request.rlen);
 }
 
 bool devTEF_Radio_Tune_To (uint16_t frequency)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Tune_To, 7, 4, frequency);
+  return devTEF_Set_Cmd<TEF_FM_TUNE_TO>(4, frequency);
 }
 
 bool devTEF_Radio_Tune_To_AM (uint16_t frequency)
 {
-  return devTEF_Set_Cmd(TEF_AM, Cmd_Tune_To, 7, 1, frequency);
+  return devTEF_Set_Cmd<TEF_AM_TUNE_TO>(1, frequency);
 }
 
 bool devTEF_Radio_Set_Bandwidth(uint16_t mode, uint16_t bandwidth, uint16_t control_sensitivity, uint16_t low_level_sensitivity)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_Bandwidth, 11, mode, bandwidth, control_sensitivity, low_level_sensitivity);
+  return devTEF_Set_Cmd<TEF_FM_SET_BANDWIDTH>(mode, bandwidth, control_sensitivity, low_level_sensitivity);
 }
 
-bool devTEF_Radio_Set_Bandwidth_AM(uint16_t mode, uint16_t bandwidth, uint16_t control_sensitivity, uint16_t low_level_sensitivity)
+// The AM frame carries no sensitivity settings, unlike the FM one
+bool devTEF_Radio_Set_Bandwidth_AM(uint16_t mode, uint16_t bandwidth)
 {
-  return devTEF_Set_Cmd(TEF_AM, Cmd_Set_Bandwidth, 7, mode, bandwidth, control_sensitivity, low_level_sensitivity);
+  return devTEF_Set_Cmd<TEF_AM_SET_BANDWIDTH>(mode, bandwidth);
 }
 
 bool devTEF_Radio_Set_LevelOffset(int16_t offset)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_LevelOffset, 5, offset - 70);
+  return devTEF_Set_Cmd<TEF_FM_SET_LEVELOFFSET>(offset - 70);
 }
 
 bool devTEF_Radio_Set_Highcut_Level(uint16_t mode, uint16_t start, uint16_t slope)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_Highcut_Level, 9, mode, start, slope);
+  return devTEF_Set_Cmd<TEF_FM_SET_HIGHCUT_LEVEL>(mode, start, slope);
 }
 
 bool devTEF_Radio_Set_Highcut_Noise(uint16_t mode, uint16_t start, uint16_t slope)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_Highcut_Noise, 9, mode, start, slope);
+  return devTEF_Set_Cmd<TEF_FM_SET_HIGHCUT_NOISE>(mode, start, slope);
 }
 
 bool devTEF_Radio_Set_Highcut_Mph(uint16_t mode, uint16_t start, uint16_t slope)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_Highcut_Mph, 9, mode, start, slope);
+  return devTEF_Set_Cmd<TEF_FM_SET_HIGHCUT_MPH>(mode, start, slope);
 }
 
 bool devTEF_Radio_Set_Highcut_Max(uint16_t mode, uint16_t limit)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_Highcut_Max, 7, mode, limit);
+  return devTEF_Set_Cmd<TEF_FM_SET_HIGHCUT_MAX>(mode, limit);
 }
 
 bool devTEF_Radio_Set_Stereo_Level(uint16_t mode, uint16_t start, uint16_t slope)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_Stereo_Level, 9, mode, start, slope);
+  return devTEF_Set_Cmd<TEF_FM_SET_STEREO_LEVEL>(mode, start, slope);
 }
 
 bool devTEF_Radio_Set_Stereo_Noise(uint16_t mode, uint16_t start, uint16_t slope)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_Stereo_Noise, 9, mode, start, slope);
+  return devTEF_Set_Cmd<TEF_FM_SET_STEREO_NOISE>(mode, start, slope);
 }
 
 bool devTEF_Radio_Set_Stereo_Mph(uint16_t mode, uint16_t start, uint16_t slope)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_Stereo_Mph, 9, mode, start, slope);
+  return devTEF_Set_Cmd<TEF_FM_SET_STEREO_MPH>(mode, start, slope);
 }
 
 bool devTEF_Radio_Set_MphSuppression(uint16_t mph)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_MphSuppression, 5, mph, 0);
+  return devTEF_Set_Cmd<TEF_FM_SET_MPHSUPPRESSION>(mph);
 }
 
 bool devTEF_Radio_Set_ChannelEqualizer(uint16_t eq)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_ChannelEqualizer, 5, eq, 0);
+  return devTEF_Set_Cmd<TEF_FM_SET_CHANNELEQUALIZER>(eq);
 }
 
 bool devTEF_Radio_Set_Stereo_Min(uint16_t mode)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_Stereo_Min, 7, mode);
+  return devTEF_Set_Cmd<TEF_FM_SET_STEREO_MIN>(mode);
 }
 
 bool devTEF_Radio_Set_RFAGC(uint16_t start)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_RFAGC, 7, start, 0, 0);
+  return devTEF_Set_Cmd<TEF_FM_SET_RFAGC>(start, 0);
 }
 
 bool devTEF_Radio_Set_Deemphasis(uint16_t timeconstant)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_Deemphasis, 5, timeconstant, 0);
+  return devTEF_Set_Cmd<TEF_FM_SET_DEEMPHASIS>(timeconstant);
 }
 
 bool devTEF_Audio_Set_Volume(int16_t volume)
 {
-  return devTEF_Set_Cmd(TEF_AUDIO, Cmd_Set_Volume, 5, volume * 10);
+  return devTEF_Set_Cmd<TEF_AUDIO_SET_VOLUME>(volume * 10);
 }
 
 bool devTEF_Audio_Set_Mute(uint16_t mode)
 {
-  return devTEF_Set_Cmd(TEF_AUDIO, Cmd_Set_Mute, 5, mode);
+  return devTEF_Set_Cmd<TEF_AUDIO_SET_MUTE>(mode);
 }
 
 bool devTEF_APPL_Set_OperationMode(uint16_t mode)
 {
-  return devTEF_Set_Cmd(TEF_APPL, Cmd_Set_OperationMode, 5, mode);
+  return devTEF_Set_Cmd<TEF_APPL_SET_OPERATIONMODE>(mode);
 }
 
 bool devTEF_APPL_Get_Operation_Status (uint8_t *bootstatus)
@@ -151,11 +270,12 @@ bool devTEF_APPL_Get_Operation_Status (uint8_t *bootstatus)
   return r;
 }
 
-bool devTEF_Radio_Get_Quality_Status (int16_t *level, uint16_t *usn, uint16_t *wam, int16_t *offset, uint16_t *bandwidth, uint16_t *mod)
+bool devTEF_Radio_Get_Quality_Status (uint16_t *status, int16_t *level, uint16_t *usn, uint16_t *wam, int16_t *offset, uint16_t *bandwidth, uint16_t *mod)
 {
   uint8_t buf[14];
   uint16_t r = devTEF_Get_Cmd(TEF_FM, Cmd_Get_Quality_Status, buf, sizeof(buf));
 
+  *status = Convert8bto16b(buf);
   *level = Convert8bto16b(buf + 2);
   *usn = Convert8bto16b(buf + 4);
   *wam = Convert8bto16b(buf + 6);
@@ -165,11 +285,12 @@ bool devTEF_Radio_Get_Quality_Status (int16_t *level, uint16_t *usn, uint16_t *w
   return r;
 }
 
-bool devTEF_Radio_Get_Quality_Status_AM (int16_t *level, uint16_t *usn, uint16_t *wam, int16_t *offset, uint16_t *bandwidth, uint16_t *mod)
+bool devTEF_Radio_Get_Quality_Status_AM (uint16_t *status, int16_t *level, uint16_t *usn, uint16_t *wam, int16_t *offset, uint16_t *bandwidth, uint16_t *mod)
 {
   uint8_t buf[14];
   uint16_t r = devTEF_Get_Cmd(TEF_AM, Cmd_Get_Quality_Status, buf, sizeof(buf));
 
+  *status = Convert8bto16b(buf);
   *level = Convert8bto16b(buf + 2);
   *usn = Convert8bto16b(buf + 4);
   *wam = Convert8bto16b(buf + 6);
@@ -179,17 +300,35 @@ bool devTEF_Radio_Get_Quality_Status_AM (int16_t *level, uint16_t *usn, uint16_t
   return r;
 }
 
-bool devTEF_Radio_Get_RDS_Data (uint16_t *status, uint16_t *A_block, uint16_t *B_block, uint16_t *C_block, uint16_t *D_block, uint16_t *dec_error)
+static void devTEF_Radio_RDS_Data(const uint8_t *buf, uint16_t *status, uint16_t *A_block, uint16_t *B_block, uint16_t *C_block, uint16_t *D_block, uint16_t *dec_error)
 {
-  uint8_t buf[12];
-  uint8_t r = devTEF_Get_Cmd(TEF_FM, Cmd_Get_RDS_Data, buf, sizeof(buf));
-
   *status = Convert8bto16b(buf);
   *A_block = Convert8bto16b(buf + 2);
   *B_block = Convert8bto16b(buf + 4);
   *C_block = Convert8bto16b(buf + 6);
   *D_block = Convert8bto16b(buf + 8);
   *dec_error = Convert8bto16b(buf + 10);
+}
+
+bool devTEF_Radio_Get_RDS_Data (uint16_t *status, uint16_t *A_block, uint16_t *B_block, uint16_t *C_block, uint16_t *D_block, uint16_t *dec_error)
+{
+  uint8_t buf[12];
+  uint8_t r = devTEF_Get_Cmd(TEF_FM, Cmd_Get_RDS_Data, buf, sizeof(buf));
+
+  devTEF_Radio_RDS_Data(buf, status, A_block, B_block, C_block, D_block, dec_error);
+  return r;
+}
+
+bool devTEF_Radio_Get_RDS_Data_Submit(TEF_GET_REQUEST *get)
+{
+  return devTEF_Get_Cmd_Submit(get, TEF_FM, Cmd_Get_RDS_Data, 12);
+}
+
+bool devTEF_Radio_Get_RDS_Data_Collect(TEF_GET_REQUEST *get, uint16_t *status, uint16_t *A_block, uint16_t *B_block, uint16_t *C_block, uint16_t *D_block, uint16_t *dec_error)
+{
+  uint8_t r = devTEF_Get_Cmd_Collect(get);
+
+  devTEF_Radio_RDS_Data(get->reply, status, A_block, B_block, C_block, D_block, dec_error);
   return r;
 }
 
@@ -204,7 +343,7 @@ bool devTEF_Radio_Get_Stereo_Status(uint16_t *status)
 
 bool devTEF_Radio_Set_RDS(void)
 {
-  return devTEF_Set_Cmd(TEF_FM, Cmd_Set_RDS, 9, 1, 1, 0);
+  return devTEF_Set_Cmd<TEF_FM_SET_RDS>(1, 1, 0);
 }
 
 bool devTEF_Radio_Get_Identification (uint16_t *device, uint16_t *hw_version, uint16_t *sw_version)
@@ -1,3 +1,5 @@
+#include <array>
+
 typedef enum
 { TEF_FM    = 32,
   TEF_AM    = 33,
@@ -39,20 +41,99 @@ typedef enum
   Cmd_Get_Identification = 130
 } TEF_APPL_COMMAND;
 
-bool devTEF_Set_Cmd(TEF_MODULE module, uint8_t cmd, uint16_t len, ...);
+// Command descriptor: module, command and number of 16 bit parameters. The
+// frame length follows from the parameter count, so a call with the wrong
+// number of parameters does not compile.
+template <TEF_MODULE Module, uint8_t Cmd, uint8_t Params>
+struct TEF_COMMAND
+{
+  static constexpr TEF_MODULE module = Module;
+  static constexpr uint8_t cmd = Cmd;
+  static constexpr uint8_t params = Params;
+  typedef std::array<uint8_t, 3 + 2 * Params> FRAME;
+};
+
+typedef TEF_COMMAND<TEF_FM, Cmd_Tune_To, 2>               TEF_FM_TUNE_TO;
+typedef TEF_COMMAND<TEF_AM, Cmd_Tune_To, 2>               TEF_AM_TUNE_TO;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_Bandwidth, 4>         TEF_FM_SET_BANDWIDTH;
+typedef TEF_COMMAND<TEF_AM, Cmd_Set_Bandwidth, 2>         TEF_AM_SET_BANDWIDTH;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_RFAGC, 2>             TEF_FM_SET_RFAGC;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_MphSuppression, 1>    TEF_FM_SET_MPHSUPPRESSION;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_ChannelEqualizer, 1>  TEF_FM_SET_CHANNELEQUALIZER;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_Deemphasis, 1>        TEF_FM_SET_DEEMPHASIS;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_LevelOffset, 1>       TEF_FM_SET_LEVELOFFSET;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_Highcut_Level, 3>     TEF_FM_SET_HIGHCUT_LEVEL;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_Highcut_Noise, 3>     TEF_FM_SET_HIGHCUT_NOISE;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_Highcut_Mph, 3>       TEF_FM_SET_HIGHCUT_MPH;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_Highcut_Max, 2>       TEF_FM_SET_HIGHCUT_MAX;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_Stereo_Level, 3>      TEF_FM_SET_STEREO_LEVEL;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_Stereo_Noise, 3>      TEF_FM_SET_STEREO_NOISE;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_Stereo_Mph, 3>        TEF_FM_SET_STEREO_MPH;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_Stereo_Min, 1>        TEF_FM_SET_STEREO_MIN;
+typedef TEF_COMMAND<TEF_FM, Cmd_Set_RDS, 3>               TEF_FM_SET_RDS;
+typedef TEF_COMMAND<TEF_AUDIO, Cmd_Set_Volume, 1>         TEF_AUDIO_SET_VOLUME;
+typedef TEF_COMMAND<TEF_AUDIO, Cmd_Set_Mute, 1>           TEF_AUDIO_SET_MUTE;
+typedef TEF_COMMAND<TEF_APPL, Cmd_Set_OperationMode, 1>   TEF_APPL_SET_OPERATIONMODE;
+
+bool devTEF_Write_Frame(uint8_t *buf, uint16_t len);
+
+template <size_t N>
+inline void devTEF_Put(std::array<uint8_t, N> &, uint8_t)
+{
+}
+
+template <size_t N, typename... Rest>
+inline void devTEF_Put(std::array<uint8_t, N> &frame, uint8_t i, uint16_t value, Rest... rest)
+{
+  frame[i] = (uint8_t)(value >> 8);
+  frame[i + 1] = (uint8_t)value;
+  devTEF_Put(frame, i + 2, rest...);
+}
+
+// devTEF_Set_Cmd<TEF_FM_SET_DEEMPHASIS>(timeconstant)
+template <typename Command, typename... Params>
+inline bool devTEF_Set_Cmd(Params... params)
+{
+  static_assert(sizeof...(Params) == Command::params, "wrong parameter count for this tuner command");
+  typename Command::FRAME frame;
+
+  frame[0] = Command::module;
+  frame[1] = Command::cmd;
+  frame[2] = 1;
+  devTEF_Put(frame, 3, params...);
+  return devTEF_Write_Frame(frame.data(), frame.size());
+}
+
+// A get command handed to the I2C engine by devTEF_Get_Cmd_Submit. The reply
+// is picked up with devTEF_Get_Cmd_Collect; until then the struct must stay put.
+typedef struct
+{ TUNER_REQUEST request;
+  uint8_t cmd[3];
+  uint8_t reply[12];
+  bool queued;
+} TEF_GET_REQUEST;
+
+bool devTEF_Get_Cmd_SelfTest(void);
+bool devTEF_Get_Cmd_Submit(TEF_GET_REQUEST *get, TEF_MODULE module, uint8_t cmd, uint16_t len);
+bool devTEF_Get_Cmd_Collect(TEF_GET_REQUEST *get);
+void devTEF_Shadow_Invalidate(void);
+void devTEF_Shadow_Stats(uint32_t *hits, uint32_t *misses);
+void devTEF_Shadow_Reset_Stats(void);
 bool devTEF_Radio_Tune_To (uint16_t frequency);
 bool devTEF_Radio_Tune_To_AM (uint16_t frequency);
 bool devTEF_Radio_Get_Identification (uint16_t *device, uint16_t *hw_version, uint16_t *sw_version);
-bool devTEF_Radio_Get_Quality_Status (int16_t *level, uint16_t *usn, uint16_t *wam, int16_t *offset, uint16_t *bandwidth, uint16_t *mod);
-bool devTEF_Radio_Get_Quality_Status_AM (int16_t *level, uint16_t *usn, uint16_t *wam, int16_t *offset, uint16_t *bandwidth, uint16_t *mod);
+bool devTEF_Radio_Get_Quality_Status (uint16_t *status, int16_t *level, uint16_t *usn, uint16_t *wam, int16_t *offset, uint16_t *bandwidth, uint16_t *mod);
+bool devTEF_Radio_Get_Quality_Status_AM (uint16_t *status, int16_t *level, uint16_t *usn, uint16_t *wam, int16_t *offset, uint16_t *bandwidth, uint16_t *mod);
 bool devTEF_APPL_Get_Operation_Status(uint8_t *bootstatus);
 bool devTEF_Audio_Set_Mute(uint16_t mode);
 bool devTEF_Audio_Set_Volume(int16_t volume);
 bool devTEF_Radio_Get_Stereo_Status(uint16_t *status);
 bool devTEF_APPL_Set_OperationMode(uint16_t mode);
 bool devTEF_Radio_Get_RDS_Data(uint16_t *status, uint16_t *A_block, uint16_t *B_block, uint16_t *C_block, uint16_t *D_block, uint16_t *dec_error);
+bool devTEF_Radio_Get_RDS_Data_Submit(TEF_GET_REQUEST *get);
+bool devTEF_Radio_Get_RDS_Data_Collect(TEF_GET_REQUEST *get, uint16_t *status, uint16_t *A_block, uint16_t *B_block, uint16_t *C_block, uint16_t *D_block, uint16_t *dec_error);
 bool devTEF_Radio_Set_Bandwidth(uint16_t mode, uint16_t bandwidth, uint16_t control_sensitivity, uint16_t low_level_sensitivity);
-bool devTEF_Radio_Set_Bandwidth_AM(uint16_t mode, uint16_t bandwidth, uint16_t control_sensitivity, uint16_t low_level_sensitivity);
+bool devTEF_Radio_Set_Bandwidth_AM(uint16_t mode, uint16_t bandwidth);
 bool devTEF_Radio_Set_LevelOffset(int16_t offset);
 bool devTEF_Radio_Set_Stereo_Level(uint16_t mode, uint16_t start, uint16_t slope);
 bool devTEF_Radio_Set_Stereo_Noise(uint16_t mode, uint16_t start, uint16_t slope);
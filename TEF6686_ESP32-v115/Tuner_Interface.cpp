@@ -1,8 +1,16 @@
 #include "TEF6686.h"
+#include "Profiler.h"
 #include "Tuner_Patch_Lithio_V101_p119.h"
 #include "Tuner_Patch_Lithio_V102_p224.h"
 #include "Tuner_Patch_Lithio_V205_p512.h"
+#include "Tuner_Patch_Lzss.h"
 #include <Wire.h>
+#ifdef TUNER_ASYNC
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#endif
 
 static const unsigned char tuner_init_tab[] = {
   7, 0x20, 0x0B, 0x01, 0x03, 0x98, 0x00, 0x00,
@@ -52,45 +60,482 @@ static const unsigned char tuner_init_tab9216[] = {
   2, 0xff, 100,
 };
 
-unsigned char Tuner_WriteBuffer(unsigned char *buf, uint16_t len)
+// Time the TEF668x needs after a write before it takes the next transaction
+#define TUNER_WRITE_GAP 2000
+
+#define TUNER_I2C_CLOCK       100000
+#define TUNER_I2C_CLOCK_FAST  400000
+// endTransmission(false) result for a write held for the repeated start on
+// core 1.0.x (I2C_ERROR_CONTINUE), core 2.x returns 0
+#define TUNER_I2C_CONTINUE    7
+#define TUNER_PATCH_CHUNK     24
+#define TUNER_PATCH_CHUNK_MAX (I2C_BUFFER_LENGTH - 1)
+
+static TUNER_BUS_STATS busstats;
+static volatile uint32_t writegeneration;
+static TUNER_CMD_STATS cmdstats[TUNER_CMD_SLOTS];
+static uint8_t lastmodule;
+static uint8_t lastcmd;
+static uint32_t lastwrite;
+static bool writepending;
+static TUNER_TRACE_ENTRY trace[TUNER_TRACE_SIZE];
+static uint16_t trace_head;
+static uint16_t trace_count;
+static bool trace_enabled;
+static volatile TUNER_CLOCK_PROFILE clockwanted;
+static TUNER_CLOCK_PROFILE clocknow;
+#ifdef TUNER_ASYNC
+static QueueHandle_t tunerqueue;
+static SemaphoreHandle_t tunerlock;
+#endif
+
+// Held around each transaction and by the diagnostics readers, as the engine
+// task updates the stats and the trace while the loop task reads and resets them
+static void Tuner_Lock(void)
+{
+#ifdef TUNER_ASYNC
+  if (tunerlock != NULL) {
+    xSemaphoreTake(tunerlock, portMAX_DELAY);
+  }
+#endif
+}
+
+static void Tuner_Unlock(void)
+{
+#ifdef TUNER_ASYNC
+  if (tunerlock != NULL) {
+    xSemaphoreGive(tunerlock);
+  }
+#endif
+}
+
+static void Tuner_Trace_Add(uint8_t address, uint32_t time, uint8_t flags, const unsigned char *buf, uint16_t len)
+{
+  if (trace_enabled) {
+    TUNER_TRACE_ENTRY *entry = &trace[trace_head];
+    entry->time = time;
+    entry->flags = (address == TUNER_I2C_ADDRESS) ? flags : flags | TUNER_TRACE_OTHER;
+    entry->len = (len > 255) ? 255 : len;
+    memset(entry->data, 0, sizeof(entry->data));
+    if (buf != NULL) {
+      memcpy(entry->data, buf, (len > TUNER_TRACE_DATA) ? TUNER_TRACE_DATA : len);
+    }
+    trace_head = (trace_head + 1) % TUNER_TRACE_SIZE;
+    if (trace_count < TUNER_TRACE_SIZE) {
+      trace_count++;
+    }
+  }
+}
+
+// Waits out whatever is left of the gap after the last write, so time spent
+// elsewhere since then is not added on top of it.
+static void Tuner_Pace(void)
 {
-  Wire.beginTransmission(0x64);
+  if (writepending) {
+    uint32_t start = micros();
+    uint32_t elapsed = start - lastwrite;
+    if (elapsed < TUNER_WRITE_GAP) {
+      delayMicroseconds(TUNER_WRITE_GAP - elapsed);
+      busstats.wait_us += micros() - start;
+    }
+    writepending = false;
+  }
+}
+
+static unsigned char Tuner_Bus_Write(uint8_t address, unsigned char *buf, uint16_t len)
+{
+  Tuner_Pace();
+  uint32_t start = micros();
+  Wire.beginTransmission(address);
   for (uint16_t i = 0; i < len; i++) {
     Wire.write(buf[i]);
   }
   uint8_t r = Wire.endTransmission();
-  delay(2);
+  lastwrite = micros();
+  writepending = true;
+  Tuner_Trace_Add(address, start, (r == 0) ? TUNER_TRACE_OK : 0, buf, len);
+  busstats.writes++;
+  // Get commands (0x80 and up) leave the tuner state alone
+  if (address == TUNER_I2C_ADDRESS && (len < 2 || buf[0] < 0x20 || buf[1] < 0x80)) {
+    writegeneration++;
+  }
+  busstats.bytes += len;
+  busstats.bus_us += lastwrite - start;
   return (r == 0) ? 1 : 0;
 }
 
-unsigned char Tuner_ReadBuffer(unsigned char *buf, uint16_t len)
+static unsigned char Tuner_Bus_Read(uint8_t address, unsigned char *buf, uint16_t len)
 {
-  Wire.requestFrom(0x64, len);
+  Tuner_Pace();
+  uint32_t start = micros();
+  Wire.requestFrom((int)address, len);
+  busstats.reads++;
+  busstats.bytes += len;
+  busstats.bus_us += micros() - start;
   if (Wire.available() == len) {
     for (uint16_t i = 0; i < len; i++) {
       buf[i] = Wire.read();
     }
+    Tuner_Trace_Add(address, start, TUNER_TRACE_READ | TUNER_TRACE_OK, buf, len);
     return 1;
   }
+  Tuner_Trace_Add(address, start, TUNER_TRACE_READ, NULL, len);
   return 0;
 }
 
-static uint16_t Tuner_Patch_Load(const unsigned char *pLutBytes, uint16_t size)
+// Command write and reply read in one transaction, joined by a repeated start.
+// The core only puts the write on the bus together with the read, so the
+// write is traced once the whole transaction is done.
+static unsigned char Tuner_Bus_WriteRead(uint8_t address, unsigned char *wbuf, uint16_t wlen, unsigned char *rbuf, uint16_t rlen)
 {
-  unsigned char buf[24 + 1];
-  uint16_t i, len;
-  uint16_t r;
+  Tuner_Pace();
+  uint32_t start = micros();
+  Wire.beginTransmission(address);
+  for (uint16_t i = 0; i < wlen; i++) {
+    Wire.write(wbuf[i]);
+  }
+  uint8_t r = Wire.endTransmission(false);
+  busstats.writereads++;
+  if (r != 0 && r != TUNER_I2C_CONTINUE) {
+    busstats.bytes += wlen;
+    busstats.bus_us += micros() - start;
+    Tuner_Trace_Add(address, start, 0, wbuf, wlen);
+    return 0;
+  }
+  Wire.requestFrom((int)address, rlen);
+  busstats.bytes += wlen + rlen;
+  busstats.bus_us += micros() - start;
+  if (Wire.available() == rlen) {
+    Tuner_Trace_Add(address, start, TUNER_TRACE_OK, wbuf, wlen);
+    for (uint16_t i = 0; i < rlen; i++) {
+      rbuf[i] = Wire.read();
+    }
+    Tuner_Trace_Add(address, start, TUNER_TRACE_READ | TUNER_TRACE_OK, rbuf, rlen);
+    return 1;
+  }
+  Tuner_Trace_Add(address, start, 0, wbuf, wlen);
+  Tuner_Trace_Add(address, start, TUNER_TRACE_READ, NULL, rlen);
+  return 0;
+}
+
+// Only called between transactions by whoever owns the bus
+static void Tuner_ApplyClock(void)
+{
+  if (clocknow != clockwanted) {
+    clocknow = clockwanted;
+    Wire.setClock((clocknow == TUNER_CLOCK_FAST) ? TUNER_I2C_CLOCK_FAST : TUNER_I2C_CLOCK);
+  }
+}
+
+// Only the tuner is counted per command
+static TUNER_CMD_STATS *Tuner_CmdStats(TUNER_REQUEST *request)
+{
+  if (request->address != TUNER_I2C_ADDRESS) {
+    return NULL;
+  }
+  if (request->wlen != 0) {
+    lastmodule = request->wbuf[0];
+    lastcmd = (lastmodule >= 0x20 && request->wlen > 1) ? request->wbuf[1] : 0;
+  }
+  for (uint8_t i = 0; i < TUNER_CMD_SLOTS; i++) {
+    if (cmdstats[i].module == 0) {
+      cmdstats[i].module = lastmodule;
+      cmdstats[i].cmd = lastcmd;
+      return &cmdstats[i];
+    }
+    if (cmdstats[i].module == lastmodule && cmdstats[i].cmd == lastcmd) {
+      return &cmdstats[i];
+    }
+  }
+  return NULL;
+}
+
+// A tuner reset mid-byte can leave SDA held low: clock SCL until it lets
+// go, send a stop and restart the I2C driver.
+static void Tuner_BusRecover(void)
+{
+  if (digitalRead(SDA) == HIGH) {
+    return;
+  }
+  Wire.end();
+  pinMode(SDA, INPUT_PULLUP);
+  pinMode(SCL, OUTPUT_OPEN_DRAIN);
+  for (uint8_t i = 0; i < 9 && digitalRead(SDA) == LOW; i++) {
+    digitalWrite(SCL, LOW);
+    delayMicroseconds(5);
+    digitalWrite(SCL, HIGH);
+    delayMicroseconds(5);
+  }
+  pinMode(SDA, OUTPUT_OPEN_DRAIN);
+  digitalWrite(SDA, LOW);
+  delayMicroseconds(5);
+  digitalWrite(SDA, HIGH);
+  delayMicroseconds(5);
+  Wire.begin();
+  Wire.setClock((clocknow == TUNER_CLOCK_FAST) ? TUNER_I2C_CLOCK_FAST : TUNER_I2C_CLOCK);
+  busstats.recoveries++;
+}
+
+static unsigned char Tuner_Transfer(TUNER_REQUEST *request)
+{
+  if (request->wlen != 0 && request->rlen != 0) {
+    return Tuner_Bus_WriteRead(request->address, request->wbuf, request->wlen, request->rbuf, request->rlen);
+  } else if (request->wlen != 0) {
+    return Tuner_Bus_Write(request->address, request->wbuf, request->wlen);
+  }
+  return Tuner_Bus_Read(request->address, request->rbuf, request->rlen);
+}
+
+// Runs the transaction, then hands the request back. The waiter is read up
+// front, as the owner may reuse or drop the request as soon as busy is cleared.
+static void Tuner_Complete(TUNER_REQUEST *request)
+{
+#ifdef TUNER_ASYNC
+  void *waiter = request->waiter;
+#endif
+
+  Tuner_Lock();
+  TUNER_CMD_STATS *stats = Tuner_CmdStats(request);
+  // Patch chunks are not repeated: a partly taken chunk cannot be resent,
+  // the boot status check after the upload catches those instead
+  bool repeat = request->address != TUNER_I2C_ADDRESS || lastmodule >= 0x20;
+
+  Tuner_ApplyClock();
+  request->result = Tuner_Transfer(request);
+  for (uint8_t retry = 0; request->result == 0 && repeat && retry < TUNER_RETRIES; retry++) {
+    busstats.retries++;
+    if (stats != NULL) {
+      stats->retries++;
+    }
+    Tuner_BusRecover();
+    // Give the tuner the same settling time as after a write
+    lastwrite = micros();
+    writepending = true;
+    request->result = Tuner_Transfer(request);
+  }
+  if (stats != NULL) {
+    stats->count++;
+  }
+  if (request->result == 0) {
+    busstats.errors++;
+    if (stats != NULL) {
+      stats->errors++;
+    }
+  }
+  Tuner_Unlock();
+  request->busy = false;
+#ifdef TUNER_ASYNC
+  if (waiter != NULL) {
+    xTaskNotifyGive((TaskHandle_t)waiter);
+  }
+#endif
+}
+
+#ifdef TUNER_ASYNC
+static void Tuner_Engine(void *)
+{
+  TUNER_REQUEST *request;
+
+  for (;;) {
+    if (xQueueReceive(tunerqueue, &request, portMAX_DELAY) == pdTRUE) {
+      Tuner_Complete(request);
+    }
+  }
+}
+#endif
+
+// With the engine task running the change is picked up before its next
+// transaction, so a transfer is never clocked at two speeds.
+void Tuner_SetClock(TUNER_CLOCK_PROFILE profile)
+{
+  clockwanted = profile;
+#ifdef TUNER_ASYNC
+  if (tunerqueue != NULL) {
+    return;
+  }
+#endif
+  Tuner_ApplyClock();
+}
+
+TUNER_CLOCK_PROFILE Tuner_GetClock(void)
+{
+  return clockwanted;
+}
+
+// Queues the request and returns at once; false when the queue is full.
+// Without TUNER_ASYNC the transaction is run before returning.
+bool Tuner_Submit(TUNER_REQUEST *request)
+{
+  request->waiter = NULL;
+  request->busy = true;
+#ifdef TUNER_ASYNC
+  if (tunerqueue != NULL) {
+    request->waiter = xTaskGetCurrentTaskHandle();
+    if (xQueueSend(tunerqueue, &request, 0) != pdTRUE) {
+      request->busy = false;
+      return false;
+    }
+    return true;
+  }
+#endif
+  Tuner_Complete(request);
+  return true;
+}
+
+// Blocks the submitting task until the request is done, returns its result
+unsigned char Tuner_Wait(TUNER_REQUEST *request)
+{
+#ifdef TUNER_ASYNC
+  while (request->busy) {
+    ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+  }
+#endif
+  return request->result;
+}
+
+static unsigned char Tuner_Run(TUNER_REQUEST *request)
+{
+  request->waiter = NULL;
+  request->busy = true;
+#ifdef TUNER_ASYNC
+  if (tunerqueue != NULL) {
+    request->waiter = xTaskGetCurrentTaskHandle();
+    xQueueSend(tunerqueue, &request, portMAX_DELAY);
+    return Tuner_Wait(request);
+  }
+#endif
+  Tuner_Complete(request);
+  return request->result;
+}
+
+unsigned char Tuner_WriteBuffer(unsigned char *buf, uint16_t len)
+{
+  TUNER_REQUEST request;
+  request.address = TUNER_I2C_ADDRESS;
+  request.wbuf = buf;
+  request.wlen = len;
+  request.rbuf = NULL;
+  request.rlen = 0;
+  return Tuner_Run(&request);
+}
+
+unsigned char Tuner_ReadBuffer(unsigned char *buf, uint16_t len)
+{
+  TUNER_REQUEST request;
+  request.address = TUNER_I2C_ADDRESS;
+  request.wbuf = NULL;
+  request.wlen = 0;
+  request.rbuf = buf;
+  request.rlen = len;
+  return Tuner_Run(&request);
+}
+
+unsigned char Tuner_WriteReadBuffer(unsigned char *wbuf, uint16_t wlen, unsigned char *rbuf, uint16_t rlen)
+{
+  TUNER_REQUEST request;
+  request.address = TUNER_I2C_ADDRESS;
+  request.wbuf = wbuf;
+  request.wlen = wlen;
+  request.rbuf = rbuf;
+  request.rlen = rlen;
+  return Tuner_Run(&request);
+}
+
+// For the other chips on the tuner bus, such as the converter at 0x12
+unsigned char Tuner_WriteDevice(uint8_t address, unsigned char *buf, uint16_t len)
+{
+  TUNER_REQUEST request;
+  request.address = address;
+  request.wbuf = buf;
+  request.wlen = len;
+  request.rbuf = NULL;
+  request.rlen = 0;
+  return Tuner_Run(&request);
+}
+
+void Tuner_GetBusStats(TUNER_BUS_STATS *stats)
+{
+  Tuner_Lock();
+  *stats = busstats;
+  Tuner_Unlock();
+}
+
+// Changes with every write that may change the tuner state. Unlike the bus
+// statistics it is never reset, so cached readings can be checked against it.
+uint32_t Tuner_WriteGeneration(void)
+{
+  return writegeneration;
+}
+
+void Tuner_ResetBusStats(void)
+{
+  Tuner_Lock();
+  memset(&busstats, 0, sizeof(busstats));
+  memset(cmdstats, 0, sizeof(cmdstats));
+  Tuner_Unlock();
+}
+
+// Slots are filled in order of first use, false past the last one in use
+bool Tuner_GetCmdStats(uint8_t index, TUNER_CMD_STATS *stats)
+{
+  bool r = false;
+
+  Tuner_Lock();
+  if (index < TUNER_CMD_SLOTS && cmdstats[index].module != 0) {
+    *stats = cmdstats[index];
+    r = true;
+  }
+  Tuner_Unlock();
+  return r;
+}
+
+void Tuner_Trace(bool enable)
+{
+  Tuner_Lock();
+  if (enable && !trace_enabled) {
+    trace_head = 0;
+    trace_count = 0;
+  }
+  trace_enabled = enable;
+  Tuner_Unlock();
+}
+
+uint16_t Tuner_TraceCount(void)
+{
+  return trace_count;
+}
+
+// Index 0 is the oldest transaction still in the ring buffer
+bool Tuner_TraceGet(uint16_t index, TUNER_TRACE_ENTRY *entry)
+{
+  bool r = false;
+
+  Tuner_Lock();
+  if (index < trace_count) {
+    *entry = trace[(trace_head + TUNER_TRACE_SIZE - trace_count + index) % TUNER_TRACE_SIZE];
+    r = true;
+  }
+  Tuner_Unlock();
+  return r;
+}
+
+// Writes the LZSS packed image (Tuner_Patch_Lzss.h) in chunks, size is the
+// unpacked size.
+static uint16_t Tuner_Patch_Load(const unsigned char *pLutBytes, uint16_t size, uint16_t chunk)
+{
+  unsigned char buf[TUNER_PATCH_CHUNK_MAX + 1];
+  TUNER_PATCH_STREAM stream;
+  uint16_t len;
+  uint16_t r = 1;
   buf[0] = 0x1b;
 
+  Tuner_Patch_Begin(&stream, pLutBytes);
   while (size)
   {
-    len = (size > 24) ? 24 : size;
+    len = (size > chunk) ? chunk : size;
     size -= len;
 
-    for (i = 0; i < len; i++)
-      buf[1 + i] = pLutBytes[i];
-
-    pLutBytes += len;
+    Tuner_Patch_Unpack(&stream, buf + 1, len);
 
     if (1 != (r = Tuner_WriteBuffer(buf, len + 1)))
     {
@@ -111,62 +556,62 @@ static uint16_t Tuner_Table_Write(const unsigned char *tab)
   }
 }
 
-uint16_t Tuner_Patch(byte TEF) {
-  Wire.beginTransmission(0x64);
-  Wire.write(0x1e);
-  Wire.write(0x5a);
-  Wire.write(0x01);
-  Wire.write(0x5a);
-  Wire.write(0x5a);
-  Wire.endTransmission();
+// fast: upload in chunks as large as the Wire buffer at the fast clock,
+// otherwise in the original 24 byte chunks at the quiet clock
+uint16_t Tuner_Patch(byte TEF, bool fast) {
+  TUNER_CLOCK_PROFILE profile = Tuner_GetClock();
+  unsigned char reset[] = {0x1e, 0x5a, 0x01, 0x5a, 0x5a};
+  unsigned char idle[] = {0x1c, 0x00, 0x00};
+  unsigned char patch[] = {0x1c, 0x00, 0x74};
+  unsigned char lut[] = {0x1c, 0x00, 0x75};
+  uint16_t chunk = fast ? TUNER_PATCH_CHUNK_MAX : TUNER_PATCH_CHUNK;
+  uint16_t r = 0;
+
+  Tuner_SetClock(fast ? TUNER_CLOCK_FAST : TUNER_CLOCK_QUIET);
+  Tuner_WriteBuffer(reset, sizeof(reset));
   delay(100);
-  Wire.beginTransmission(0x64);
-  Wire.write(0x1c);
-  Wire.write(0x00);
-  Wire.write(0x00);
-  Wire.endTransmission();
+  Tuner_WriteBuffer(idle, sizeof(idle));
   delay(100);
-  Wire.beginTransmission(0x64);
-  Wire.write(0x1c);
-  Wire.write(0x00);
-  Wire.write(0x74);
-  Wire.endTransmission();
+  Tuner_WriteBuffer(patch, sizeof(patch));
   if (TEF == 101) {
-    Tuner_Patch_Load(pPatchBytes101, PatchSize101);
+    r = Tuner_Patch_Load(pPatchBytes101, PatchSize101, chunk);
   } else if (TEF == 102) {
-    Tuner_Patch_Load(pPatchBytes102, PatchSize102);
+    r = Tuner_Patch_Load(pPatchBytes102, PatchSize102, chunk);
   } else if (TEF == 205) {
-    Tuner_Patch_Load(pPatchBytes205, PatchSize205);
+    r = Tuner_Patch_Load(pPatchBytes205, PatchSize205, chunk);
   }
-  Wire.beginTransmission(0x64);
-  Wire.write(0x1c);
-  Wire.write(0x00);
-  Wire.write(0x00);
-  Wire.endTransmission();
+  Profiler_Mark("patch upload");
+  Tuner_WriteBuffer(idle, sizeof(idle));
   delay(100);
-  Wire.beginTransmission(0x64);
-  Wire.write(0x1c);
-  Wire.write(0x00);
-  Wire.write(0x75);
-  Wire.endTransmission();
-  if (TEF == 101) {
-    Tuner_Patch_Load(pLutBytes101, LutSize101);
-  } else if (TEF == 102) {
-    Tuner_Patch_Load(pLutBytes102, LutSize102);
-  } else if (TEF == 205) {
-    Tuner_Patch_Load(pLutBytes205, LutSize205);
+  Tuner_WriteBuffer(lut, sizeof(lut));
+  if (r == 1) {
+    if (TEF == 101) {
+      r = Tuner_Patch_Load(pLutBytes101, LutSize101, chunk);
+    } else if (TEF == 102) {
+      r = Tuner_Patch_Load(pLutBytes102, LutSize102, chunk);
+    } else if (TEF == 205) {
+      r = Tuner_Patch_Load(pLutBytes205, LutSize205, chunk);
+    }
   }
-  Wire.beginTransmission(0x64);
-  Wire.write(0x1c);
-  Wire.write(0x00);
-  Wire.write(0x00);
-  Wire.endTransmission();
+  Profiler_Mark("LUT upload");
+  Tuner_WriteBuffer(idle, sizeof(idle));
+  Tuner_SetClock(profile);
+  return r;
 }
 
 void Tuner_I2C_Init() {
   Wire.begin();
-  Wire.setClock(100000);
+  Wire.setClock(TUNER_I2C_CLOCK);
+  clocknow = TUNER_CLOCK_QUIET;
+  clockwanted = TUNER_CLOCK_QUIET;
   delay(5);
+#ifdef TUNER_ASYNC
+  if (tunerqueue == NULL) {
+    tunerlock = xSemaphoreCreateMutex();
+    tunerqueue = xQueueCreate(TUNER_QUEUE_LENGTH, sizeof(TUNER_REQUEST *));
+    xTaskCreatePinnedToCore(Tuner_Engine, "tuner", 4096, NULL, 2, NULL, 0);
+  }
+#endif
 }
 
 uint8_t Tuner_Init(void) {
@@ -1,7 +1,85 @@
+// Comment out to run the tuner I2C transactions on the calling task
+#define TUNER_ASYNC
+
+typedef struct
+{ uint32_t writes;
+  uint32_t reads;
+  uint32_t writereads;
+  uint32_t bytes;
+  uint32_t bus_us;
+  uint32_t wait_us;
+  uint32_t errors;
+  uint32_t retries;
+  uint32_t recoveries;
+} TUNER_BUS_STATS;
+
+#define TUNER_RETRIES    2
+#define TUNER_CMD_SLOTS  48
+
+// Per command transaction counts, plain reads count for the last command
+// written. Patch and boot writes (module below 0x20) are counted per module.
+typedef struct
+{ uint8_t module;
+  uint8_t cmd;
+  uint32_t count;
+  uint32_t errors;
+  uint32_t retries;
+} TUNER_CMD_STATS;
+
+#define TUNER_TRACE_SIZE  256
+#define TUNER_TRACE_DATA  16
+#define TUNER_TRACE_READ  0x01
+#define TUNER_TRACE_OK    0x02
+#define TUNER_TRACE_OTHER 0x04
+
+#define TUNER_I2C_ADDRESS 0x64
+
+typedef struct
+{ uint32_t time;
+  uint8_t flags;
+  uint8_t len;
+  uint8_t data[TUNER_TRACE_DATA];
+} TUNER_TRACE_ENTRY;
+
+// One I2C transaction: a write (rlen 0), a read (wlen 0) or a write and a
+// read joined by a repeated start. The buffers must stay valid until done.
+typedef struct
+{ uint8_t address;
+  unsigned char *wbuf;
+  uint16_t wlen;
+  unsigned char *rbuf;
+  uint16_t rlen;
+  void *waiter;
+  volatile bool busy;
+  unsigned char result;
+} TUNER_REQUEST;
+
+#define TUNER_QUEUE_LENGTH 8
+
+// Bus clock by activity: quiet while listening, fast while audio is muted
+// anyway (boot, patch upload, scans, seek)
+typedef enum
+{ TUNER_CLOCK_QUIET = 0,
+  TUNER_CLOCK_FAST  = 1
+} TUNER_CLOCK_PROFILE;
+
 void Tuner_I2C_Init(void);
-uint16_t Tuner_Patch(byte TEF);
+uint16_t Tuner_Patch(byte TEF, bool fast);
 uint8_t Tuner_Init(void);
 uint8_t Tuner_Init4000(void);
 uint8_t Tuner_Init9216(void);
 unsigned char Tuner_WriteBuffer(unsigned char *buf, uint16_t len);
 unsigned char Tuner_ReadBuffer(unsigned char *buf, uint16_t len);
+unsigned char Tuner_WriteDevice(uint8_t address, unsigned char *buf, uint16_t len);
+unsigned char Tuner_WriteReadBuffer(unsigned char *wbuf, uint16_t wlen, unsigned char *rbuf, uint16_t rlen);
+void Tuner_SetClock(TUNER_CLOCK_PROFILE profile);
+TUNER_CLOCK_PROFILE Tuner_GetClock(void);
+bool Tuner_Submit(TUNER_REQUEST *request);
+unsigned char Tuner_Wait(TUNER_REQUEST *request);
+void Tuner_GetBusStats(TUNER_BUS_STATS *stats);
+void Tuner_ResetBusStats(void);
+uint32_t Tuner_WriteGeneration(void);
+bool Tuner_GetCmdStats(uint8_t index, TUNER_CMD_STATS *stats);
+void Tuner_Trace(bool enable);
+uint16_t Tuner_TraceCount(void);
+bool Tuner_TraceGet(uint16_t index, TUNER_TRACE_ENTRY *entry);
@@ -0,0 +1,59 @@
+#ifndef Tuner_Patch_Lzss_h
+#define Tuner_Patch_Lzss_h
+
+#include <stdint.h>
+
+// Patch and LUT images are stored LZSS packed (tools/patchpack.py): a flag
+// byte announces eight items LSB first, a set bit is a back reference of two
+// bytes (distance - 1, length - 3) into the last 256 output bytes, a clear
+// bit one literal byte. The stream carries no length, the caller knows the
+// unpacked size. Kept free of Arduino headers for tools/patchpack_test.cpp.
+typedef struct
+{ const unsigned char *src;
+  unsigned char window[256];
+  uint8_t head;
+  uint8_t from;
+  uint16_t copy;
+  uint16_t flags;
+} TUNER_PATCH_STREAM;
+
+static inline void Tuner_Patch_Begin(TUNER_PATCH_STREAM *stream, const unsigned char *src)
+{
+  stream->src = src;
+  stream->head = 0;
+  stream->from = 0;
+  stream->copy = 0;
+  stream->flags = 0;
+}
+
+// Unpacks the next len bytes to out, a back reference may span two calls
+static inline void Tuner_Patch_Unpack(TUNER_PATCH_STREAM *stream, unsigned char *out, uint16_t len)
+{
+  uint16_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    if (stream->copy == 0)
+    {
+      if (stream->flags <= 1)
+        stream->flags = 0x100 | *stream->src++;
+      if (stream->flags & 1)
+      {
+        stream->from = stream->head - 1 - stream->src[0];
+        stream->copy = stream->src[1] + 3;
+        stream->src += 2;
+      } else {
+        stream->window[stream->head] = *stream->src++;
+      }
+      stream->flags >>= 1;
+    }
+    if (stream->copy)
+    {
+      stream->window[stream->head] = stream->window[stream->from++];
+      stream->copy--;
+    }
+    out[i] = stream->window[stream->head++];
+  }
+}
+
+#endif
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+Pack an NXP Lithio patch header (PatchByteValues / LutByteValues arrays)
+into the LZSS format read by Tuner_Patch_Load() in Tuner_Interface.cpp.
+
+  python3 tools/patchpack.py <NXP header> <output header>
+
+Stream format: a flag byte announces the next eight items, LSB first.
+A clear bit is one literal byte. A set bit is a back reference of two
+bytes, distance - 1 and length - 3, into the last 256 output bytes.
+The stream ends when the unpacked size (PatchSize / LutSize) is reached.
+
+tools/patchpack_test.cpp checks the decoder used on the ESP32 against the
+NXP headers, see the comment at its top.
+"""
+
+import re
+import sys
+
+WINDOW = 256
+MIN_MATCH = 3
+MAX_MATCH = MIN_MATCH + 255
+
+
+def pack(data):
+    n = len(data)
+    # Cheapest encoding in bits of data[i:], literal 9 bits, reference 17 bits
+    cost = [0] * (n + 1)
+    step = [None] * (n + 1)
+    for i in range(n - 1, -1, -1):
+        cost[i] = cost[i + 1] + 9
+        step[i] = None
+        for distance in range(1, min(WINDOW, i) + 1):
+            length = 0
+            while (length < MAX_MATCH and i + length < n and
+                   data[i + length - distance] == data[i + length]):
+                length += 1
+            for l in range(MIN_MATCH, length + 1):
+                if cost[i + l] + 17 < cost[i]:
+                    cost[i] = cost[i + l] + 17
+                    step[i] = (distance, l)
+
+    out = bytearray()
+    flagpos = 0
+    bit = 8
+    i = 0
+    while i < n:
+        if bit == 8:
+            flagpos = len(out)
+            out.append(0)
+            bit = 0
+        if step[i] is None:
+            out.append(data[i])
+            i += 1
+        else:
+            distance, length = step[i]
+            out[flagpos] |= 1 << bit
+            out.append(distance - 1)
+            out.append(length - MIN_MATCH)
+            i += length
+        bit += 1
+    return bytes(out)
+
+
+def unpack(packed, size):
+    out = bytearray()
+    pos = 0
+    flags = 0
+    while len(out) < size:
+        if flags <= 1:
+            flags = 0x100 | packed[pos]
+            pos += 1
+        if flags & 1:
+            distance = packed[pos] + 1
+            length = packed[pos + 1] + MIN_MATCH
+            pos += 2
+            for _ in range(length):
+                out.append(out[-distance])
+        else:
+            out.append(packed[pos])
+            pos += 1
+        flags >>= 1
+    return bytes(out[:size])
+
+
+def array(name, data):
+    lines = []
+    for i in range(0, len(data), 24):
+        lines.append("  " + ", ".join("0x%02X" % b for b in data[i:i + 24]))
+    return ("static const unsigned char %s[] =\n{\n%s\n};\n"
+            % (name, ",\n".join(lines)))
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    source = open(sys.argv[1]).read()
+    arrays = re.findall(r"static (?:const )?unsigned char (Patch|Lut)ByteValues(\d+)\[\] =\s*\{(.*?)\};",
+                        source, re.S)
+    if len(arrays) != 2:
+        sys.exit("%s: expected a patch and a LUT array" % sys.argv[1])
+
+    header = "// LZSS packed by tools/patchpack.py, see Tuner_Patch_Load()\n"
+    for kind, version, body in arrays:
+        data = bytes(int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]+", body))
+        packed = pack(data)
+        if unpack(packed, len(data)) != data:
+            sys.exit("%s%s: round trip failed" % (kind, version))
+        name = "%sByteValues%s" % (kind, version)
+        header += "\nextern const size_t %sSize%s;\n" % (kind, version)
+        header += "extern const unsigned char *p%sBytes%s;\n" % (kind, version)
+        header += array(name, packed)
+        header += "\nconst size_t %sSize%s = %d;\n" % (kind, version, len(data))
+        header += "const unsigned char *p%sBytes%s = &%s[0];\n" % (kind, version, name)
+        print("%s: %d -> %d bytes" % (name, len(data), len(packed)))
+
+    open(sys.argv[2], "w", newline="\r\n").write(header)
+
+
+if __name__ == "__main__":
+    main()
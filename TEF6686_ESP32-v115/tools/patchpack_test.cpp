@@ -0,0 +1,103 @@
+// Host round trip check of the patch decoder in Tuner_Patch_Lzss.h against
+// the unpacked NXP headers. Run it from the sketch folder after repacking a
+// patch, with REV the last commit holding the NXP headers as shipped
+// (the parent of the first packed one in git log -- Tuner_Patch_Lithio_V101_p119.h):
+//
+//   mkdir /tmp/nxp
+//   for f in V101_p119 V102_p224 V205_p512; do
+//     git show REV:./Tuner_Patch_Lithio_$f.h > /tmp/nxp/Tuner_Patch_Lithio_$f.h
+//   done
+//   g++ -I/tmp/nxp -o /tmp/patchpack_test tools/patchpack_test.cpp && /tmp/patchpack_test
+//
+// The packed headers next to the sketch are included by relative path, the
+// NXP originals through the -I directory.
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "../Tuner_Patch_Lzss.h"
+
+namespace packed {
+#include "../Tuner_Patch_Lithio_V101_p119.h"
+#include "../Tuner_Patch_Lithio_V102_p224.h"
+#include "../Tuner_Patch_Lithio_V205_p512.h"
+}
+
+namespace nxp {
+#include <Tuner_Patch_Lithio_V101_p119.h>
+#include <Tuner_Patch_Lithio_V102_p224.h>
+#include <Tuner_Patch_Lithio_V205_p512.h>
+}
+
+typedef struct
+{ const char *name;
+  const unsigned char *packed;
+  size_t packedsize;
+  size_t size;
+  const unsigned char *original;
+  size_t originalsize;
+} IMAGE;
+
+#define IMAGE(kind, version) \
+  { #kind "ByteValues" #version, packed::p##kind##Bytes##version, sizeof(packed::kind##ByteValues##version), \
+    packed::kind##Size##version, nxp::p##kind##Bytes##version, nxp::kind##Size##version }
+
+static const IMAGE images[] =
+{
+  IMAGE(Patch, 101), IMAGE(Lut, 101),
+  IMAGE(Patch, 102), IMAGE(Lut, 102),
+  IMAGE(Patch, 205), IMAGE(Lut, 205)
+};
+
+// 24 is the slow upload, 127 the fast one with the ESP32 Wire buffer
+static const uint16_t chunks[] = {1, 3, 24, 127, 255, 256, 1000};
+
+// Unpacks like Tuner_Patch_Load(), chunk by chunk
+static bool check(const IMAGE *image, uint16_t chunk)
+{
+  static unsigned char out[65536];
+  unsigned char buf[1000];
+  TUNER_PATCH_STREAM stream;
+  size_t size = image->size;
+  size_t done = 0;
+  uint16_t len;
+
+  Tuner_Patch_Begin(&stream, image->packed);
+  while (size)
+  {
+    len = (size > chunk) ? chunk : size;
+    size -= len;
+    Tuner_Patch_Unpack(&stream, buf, len);
+    memcpy(out + done, buf, len);
+    done += len;
+  }
+  if (stream.src != image->packed + image->packedsize) {
+    printf("%s chunk %u: %u packed bytes used of %u\n", image->name, chunk,
+           (unsigned)(stream.src - image->packed), (unsigned)image->packedsize);
+    return false;
+  }
+  if (memcmp(out, image->original, image->size) != 0) {
+    printf("%s chunk %u: unpacked image differs\n", image->name, chunk);
+    return false;
+  }
+  return true;
+}
+
+int main()
+{
+  int failed = 0;
+
+  for (size_t i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+    if (images[i].size != images[i].originalsize) {
+      printf("%s: size %u, NXP image %u\n", images[i].name, (unsigned)images[i].size, (unsigned)images[i].originalsize);
+      failed++;
+      continue;
+    }
+    for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+      failed += !check(&images[i], chunks[c]);
+    }
+    printf("%s: %u -> %u bytes\n", images[i].name, (unsigned)images[i].size, (unsigned)images[i].packedsize);
+  }
+  printf(failed ? "FAILED\n" : "OK\n");
+  return failed ? 1 : 0;
+}